@@ -35,36 +35,40 @@ struct GraphicsPipeline {
 };
 
 struct Frame {
+    // presentation only works with binary semaphores, completion is tracked by the frame context's timeline semaphore
     VkSemaphore                  image_available_semaphore{};
     VkSemaphore                  render_finished_semaphore{};
-    VkFence                      in_flight_fence{};
-    VkRenderingInfoKHR           rendering_info{};
-    VkCommandBuffer              command_buffer{};
-    VkRenderingAttachmentInfoKHR attachment_info{};
     VkCommandBufferSubmitInfoKHR command_buffer_submit_info{};
     VkSemaphoreSubmitInfoKHR     wait_semaphore_submit_info{};
-    VkSemaphoreSubmitInfoKHR     signal_semaphore_submit_info{};
-    VkSubmitInfo2                submit_info_2{};
-    VkImageMemoryBarrier2        end_render_image_memory_barrier{};
-    VkDependencyInfoKHR          dependency_info{};
+    // the render finished semaphore, then the timeline semaphore
+    std::array<VkSemaphoreSubmitInfoKHR, 2> signal_semaphore_submit_infos{};
+    VkSubmitInfo2                           submit_info_2{};
 };
 
 struct VkContext {
-    VkInstance         instance{};
-    VkPhysicalDevice   physical_device{};
-    VkDevice           device{};
-    VkCommandPool      frame_command_pool{};
-    VkQueue            graphics_queue{};
-    VkQueue            present_queue{};
-    GLFWwindow*        window{};
-    uint32_t           graphics_present_queue_family{};
-    VkSurfaceKHR       surface{};
-    SwapchainContext   swapchain_ctx{};
-    GraphicsPipeline   graphics_pipeline{};
-    std::vector<Frame> frames{};
-    uint64_t           curr_frame{};
+    VkInstance               instance{};
+    VkPhysicalDevice         physical_device{};
+    VkDevice                 device{};
+    vk_lib::CommandAllocator command_allocator{};
+    vk_lib::QueueSetup       queue_setup{};
+    VkQueue                  graphics_queue{};
+    VkQueue                  present_queue{};
+    VkQueue                  compute_queue{};
+    VkQueue                  transfer_queue{};
+    GLFWwindow*              window{};
+    uint32_t                 graphics_present_queue_family{};
+    VkSurfaceKHR             surface{};
+    SwapchainContext         swapchain_ctx{};
+    GraphicsPipeline         graphics_pipeline{};
+    VkPipelineCache          pipeline_cache{};
+    std::vector<Frame>       frames{};
+    vk_lib::RenderGraph      render_graph{};
+    vk_lib::FrameContext     frame_context{};
 };
 
+constexpr const char* pipeline_cache_path = "pipeline_cache.bin";
+constexpr uint32_t    frames_in_flight    = 2;
+
 [[noreturn]] void abort_message(std::string_view message) {
     std::cerr << message << std::endl;
     std::abort();
@@ -126,13 +130,19 @@ VkPhysicalDevice select_physical_device(VkInstance instance) {
     return chosen_device;
 }
 
-uint32_t select_queue_family(VkPhysicalDevice physical_device, VkSurfaceKHR surface) {
+std::vector<VkQueueFamilyProperties> get_queue_family_properties(VkPhysicalDevice physical_device) {
     uint32_t                             family_property_count;
     std::vector<VkQueueFamilyProperties> queue_family_properties;
     vkGetPhysicalDeviceQueueFamilyProperties(physical_device, &family_property_count, nullptr);
     queue_family_properties.resize(family_property_count);
     vkGetPhysicalDeviceQueueFamilyProperties(physical_device, &family_property_count, queue_family_properties.data());
 
+    return queue_family_properties;
+}
+
+uint32_t select_queue_family(VkPhysicalDevice physical_device, VkSurfaceKHR surface) {
+    const std::vector<VkQueueFamilyProperties> queue_family_properties = get_queue_family_properties(physical_device);
+
     // Find a queue family with both graphics and presentation capabilities
     for (uint32_t i = 0; i < queue_family_properties.size(); i++) {
         const VkQueueFamilyProperties* family_properties = &queue_family_properties[i];
@@ -147,34 +157,38 @@ uint32_t select_queue_family(VkPhysicalDevice physical_device, VkSurfaceKHR surf
     abort_message("Could not find a suitable queue family");
 }
 
-VkDevice create_logical_device(VkPhysicalDevice physical_device, uint32_t queue_family) {
-    std::array              queue_priorities   = {1.f};
-    VkDeviceQueueCreateInfo queue_ci           = vk_lib::device_queue_create_info(queue_family, queue_priorities);
-    std::array              queue_create_infos = {queue_ci};
-
+VkDevice create_logical_device(VkPhysicalDevice physical_device, const vk_lib::QueueSetup* queue_setup) {
     std::array device_extensions = {VK_KHR_SWAPCHAIN_EXTENSION_NAME, VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME,
                                     VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME};
     // query for required features first
+    VkPhysicalDeviceVulkan12Features vk_1_2_features{};
+    vk_1_2_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
     VkPhysicalDeviceVulkan13Features vk_1_3_features{};
     vk_1_3_features.sType                                = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES;
+    vk_1_3_features.pNext                                = &vk_1_2_features;
     VkPhysicalDeviceFeatures2 physical_device_features_2 = VkPhysicalDeviceFeatures2{VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR};
     physical_device_features_2.pNext                     = &vk_1_3_features;
 
     vkGetPhysicalDeviceFeatures2(physical_device, &physical_device_features_2);
 
-    if (vk_1_3_features.dynamicRendering == VK_FALSE || vk_1_3_features.synchronization2 == VK_FALSE) {
+    if (vk_1_3_features.dynamicRendering == VK_FALSE || vk_1_3_features.synchronization2 == VK_FALSE ||
+        vk_1_2_features.timelineSemaphore == VK_FALSE) {
         abort_message("Required features are not supported by this device");
     }
-    // enable only dynamic rendering and sync 2 now, instead of all the supported features
-    vk_1_3_features                  = VkPhysicalDeviceVulkan13Features{VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES};
-    vk_1_3_features.dynamicRendering = VK_TRUE;
-    vk_1_3_features.synchronization2 = VK_TRUE;
+    // enable only dynamic rendering, sync 2 and timeline semaphores now, instead of all the supported features
+    vk_1_2_features                   = VkPhysicalDeviceVulkan12Features{VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES};
+    vk_1_2_features.timelineSemaphore = VK_TRUE;
+    vk_1_3_features                   = VkPhysicalDeviceVulkan13Features{VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES};
+    vk_1_3_features.dynamicRendering  = VK_TRUE;
+    vk_1_3_features.synchronization2  = VK_TRUE;
+    vk_1_3_features.pNext             = &vk_1_2_features;
 
     physical_device_features_2       = VkPhysicalDeviceFeatures2{VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR};
     physical_device_features_2.pNext = &vk_1_3_features;
 
-    VkDeviceCreateInfo device_ci = vk_lib::device_create_info(queue_create_infos, device_extensions, nullptr, &physical_device_features_2);
-    VkDevice           device;
+    VkDeviceCreateInfo device_ci =
+        vk_lib::device_create_info(queue_setup->queue_create_infos, device_extensions, nullptr, &physical_device_features_2);
+    VkDevice device;
     VK_CHECK(vkCreateDevice(physical_device, &device_ci, nullptr, &device));
 
     volkLoadDevice(device);
@@ -256,7 +270,8 @@ VkShaderModule load_shader(VkDevice device, const std::filesystem::path& path) {
     return shader_module;
 }
 
-GraphicsPipeline create_graphics_pipeline(VkDevice device, VkFormat color_attachment_format, uint32_t width, uint32_t height) {
+GraphicsPipeline create_graphics_pipeline(VkDevice device, VkPipelineCache pipeline_cache, VkFormat color_attachment_format, uint32_t width,
+                                          uint32_t height) {
 
     const VkViewport viewport = vk_lib::viewport(static_cast<float>(width), static_cast<float>(height));
     const VkExtent2D extent   = vk_lib::extent_2d(width, height);
@@ -289,7 +304,7 @@ GraphicsPipeline create_graphics_pipeline(VkDevice device, VkFormat color_attach
         &multisample_state, &color_blend_state, nullptr, nullptr, nullptr, 0, 0, nullptr, 0, &rendering_create_info);
 
     VkPipeline pipeline;
-    vkCreateGraphicsPipelines(device, nullptr, 1, &graphics_pipeline_ci, nullptr, &pipeline);
+    vkCreateGraphicsPipelines(device, pipeline_cache, 1, &graphics_pipeline_ci, nullptr, &pipeline);
 
     GraphicsPipeline graphics_pipeline{};
     graphics_pipeline.pipeline        = pipeline;
@@ -300,59 +315,74 @@ GraphicsPipeline create_graphics_pipeline(VkDevice device, VkFormat color_attach
     return graphics_pipeline;
 }
 
-std::vector<Frame> init_frames(VkDevice device, VkCommandPool command_pool, std::span<VkImageView> frame_image_views, std::span<VkImage> frame_images,
-                               uint32_t queue_family_index) {
+std::vector<Frame> init_frames(VkDevice device, uint32_t frame_count) {
     std::vector<Frame> frames;
-    frames.resize(frame_image_views.size());
+    frames.resize(frame_count);
 
-    for (uint32_t i = 0; i < frame_image_views.size(); i++) {
+    for (uint32_t i = 0; i < frame_count; i++) {
         Frame* frame = &frames[i];
 
-        VkImageView frame_image_view = frame_image_views[i];
-        frame->attachment_info       = vk_lib::rendering_attachment_info(frame_image_view, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
-                                                                         VK_ATTACHMENT_LOAD_OP_LOAD, VK_ATTACHMENT_STORE_OP_STORE);
-
-        VkCommandBufferAllocateInfo command_buffer_ai = vk_lib::command_buffer_allocate_info(command_pool);
-        vkAllocateCommandBuffers(device, &command_buffer_ai, &frame->command_buffer);
-
         VkSemaphoreCreateInfo semaphore_ci = vk_lib::semaphore_create_info();
         VK_CHECK(vkCreateSemaphore(device, &semaphore_ci, nullptr, &frame->image_available_semaphore));
         VK_CHECK(vkCreateSemaphore(device, &semaphore_ci, nullptr, &frame->render_finished_semaphore));
 
-        VkFenceCreateInfo fence_ci = vk_lib::fence_create_info(VK_FENCE_CREATE_SIGNALED_BIT);
-        VK_CHECK(vkCreateFence(device, &fence_ci, nullptr, &frame->in_flight_fence));
-
-        frame->command_buffer_submit_info = vk_lib::command_buffer_submit_info(frame->command_buffer);
         frame->wait_semaphore_submit_info =
             vk_lib::semaphore_submit_info(frame->image_available_semaphore, VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT_KHR);
-        frame->signal_semaphore_submit_info =
+        frame->signal_semaphore_submit_infos[0] =
             vk_lib::semaphore_submit_info(frame->render_finished_semaphore, VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT_KHR);
 
-        frame->submit_info_2 =
-            vk_lib::submit_info_2(&frame->command_buffer_submit_info, &frame->wait_semaphore_submit_info, &frame->signal_semaphore_submit_info);
-
-        VkImageSubresourceRange subresource_range = vk_lib::image_subresource_range(VK_IMAGE_ASPECT_COLOR_BIT);
-
-        VkImage frame_image = frame_images[i];
-        frame->end_render_image_memory_barrier =
-            vk_lib::image_memory_barrier_2(frame_image, subresource_range, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR,
-                                           VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT_KHR, VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT_KHR,
-                                           VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT, VK_ACCESS_2_NONE);
-        frame->dependency_info = vk_lib::dependency_info(&frame->end_render_image_memory_barrier, nullptr, nullptr);
+        // the timeline signal info is filled in every frame, its value changes
+        frame->submit_info_2 = vk_lib::submit_info_2_batch({&frame->command_buffer_submit_info, 1}, {&frame->wait_semaphore_submit_info, 1},
+                                                           frame->signal_semaphore_submit_infos);
     }
 
     return frames;
 }
 
+VkPipelineCache load_pipeline_cache(VkPhysicalDevice physical_device, VkDevice device) {
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(physical_device, &properties);
+
+    // a missing or stale cache file leaves the data empty, the cache then starts out empty
+    vk_lib::PipelineCacheFile cache_file{};
+    (void)vk_lib::pipeline_cache_file_open(pipeline_cache_path, &properties, &cache_file);
+
+    VkPipelineCacheCreateInfo pipeline_cache_ci = vk_lib::pipeline_cache_create_info(cache_file.data);
+    VkPipelineCache           pipeline_cache;
+    VK_CHECK(vkCreatePipelineCache(device, &pipeline_cache_ci, nullptr, &pipeline_cache));
+    vk_lib::pipeline_cache_file_close(&cache_file);
+
+    return pipeline_cache;
+}
+
+void save_pipeline_cache(VkPhysicalDevice physical_device, VkDevice device, VkPipelineCache pipeline_cache) {
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(physical_device, &properties);
+
+    size_t data_size = 0;
+    VK_CHECK(vkGetPipelineCacheData(device, pipeline_cache, &data_size, nullptr));
+    std::vector<uint8_t> data(data_size);
+    VK_CHECK(vkGetPipelineCacheData(device, pipeline_cache, &data_size, data.data()));
+    if (vk_lib::pipeline_cache_file_write(pipeline_cache_path, data, &properties) != VK_SUCCESS) {
+        std::cerr << "Failed to write " << pipeline_cache_path << std::endl;
+    }
+}
+
 void destroy_resources(VkContext* vk_context) {
     VkDevice device = vk_context->device;
     vkDeviceWaitIdle(device);
+    save_pipeline_cache(vk_context->physical_device, device, vk_context->pipeline_cache);
+    vkDestroyPipelineCache(device, vk_context->pipeline_cache, nullptr);
     for (Frame& frame : vk_context->frames) {
         vkDestroySemaphore(device, frame.image_available_semaphore, nullptr);
         vkDestroySemaphore(device, frame.render_finished_semaphore, nullptr);
-        vkDestroyFence(device, frame.in_flight_fence, nullptr);
     }
-    vkDestroyCommandPool(device, vk_context->frame_command_pool, nullptr);
+    vkDestroySemaphore(device, vk_context->frame_context.timeline_semaphore, nullptr);
+    std::vector<VkCommandPool> command_pools;
+    vk_lib::command_allocator_release_pools(&vk_context->command_allocator, &command_pools);
+    for (VkCommandPool command_pool : command_pools) {
+        vkDestroyCommandPool(device, command_pool, nullptr);
+    }
     vkDestroyPipeline(device, vk_context->graphics_pipeline.pipeline, nullptr);
     vkDestroyPipelineLayout(device, vk_context->graphics_pipeline.pipeline_layout, nullptr);
     vkDestroyShaderModule(device, vk_context->graphics_pipeline.vert_shader, nullptr);
@@ -380,20 +410,34 @@ int main() {
     vk_context.physical_device = select_physical_device(vk_context.instance);
     VK_CHECK(glfwCreateWindowSurface(vk_context.instance, vk_context.window, nullptr, &vk_context.surface));
     vk_context.graphics_present_queue_family = select_queue_family(vk_context.physical_device, vk_context.surface);
-    vk_context.device                        = create_logical_device(vk_context.physical_device, vk_context.graphics_present_queue_family);
-    vkGetDeviceQueue(vk_context.device, vk_context.graphics_present_queue_family, 0, &vk_context.graphics_queue);
-    vkGetDeviceQueue(vk_context.device, vk_context.graphics_present_queue_family, 0, &vk_context.present_queue);
-    vk_context.swapchain_ctx     = create_swapchain_context(vk_context.physical_device, vk_context.device, vk_context.surface, vk_context.window);
-    vk_context.graphics_pipeline = create_graphics_pipeline(vk_context.device, vk_context.swapchain_ctx.surface_format.format,
-                                                            vk_context.swapchain_ctx.extent.width, vk_context.swapchain_ctx.extent.height);
-    VkCommandPoolCreateInfo command_pool_ci =
-        vk_lib::command_pool_create_info(vk_context.graphics_present_queue_family, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
-    vkCreateCommandPool(vk_context.device, &command_pool_ci, nullptr, &vk_context.frame_command_pool);
-
-    vk_context.frames = init_frames(vk_context.device, vk_context.frame_command_pool, vk_context.swapchain_ctx.image_views,
-                                    vk_context.swapchain_ctx.images, vk_context.graphics_present_queue_family);
+    // dedicated compute and transfer families get queues of their own, so their work can overlap with rendering
+    vk_lib::queue_setup_init(&vk_context.queue_setup, get_queue_family_properties(vk_context.physical_device),
+                             vk_context.graphics_present_queue_family);
+    vk_context.device = create_logical_device(vk_context.physical_device, &vk_context.queue_setup);
+    std::vector<VkQueue> queues;
+    vk_lib::queue_setup_get_queues(&vk_context.queue_setup, vkGetDeviceQueue, vk_context.device, &queues);
+    vk_context.graphics_queue = queues[vk_context.queue_setup.role_queues[static_cast<uint32_t>(vk_lib::QueueRole::Graphics)]];
+    vk_context.present_queue  = vk_context.graphics_queue;
+    vk_context.compute_queue  = queues[vk_context.queue_setup.role_queues[static_cast<uint32_t>(vk_lib::QueueRole::Compute)]];
+    vk_context.transfer_queue = queues[vk_context.queue_setup.role_queues[static_cast<uint32_t>(vk_lib::QueueRole::Transfer)]];
 
-    const VkRect2D render_area = vk_lib::rect_2d(vk_context.swapchain_ctx.extent);
+    vk_context.swapchain_ctx     = create_swapchain_context(vk_context.physical_device, vk_context.device, vk_context.surface, vk_context.window);
+    vk_context.pipeline_cache    = load_pipeline_cache(vk_context.physical_device, vk_context.device);
+    vk_context.graphics_pipeline =
+        create_graphics_pipeline(vk_context.device, vk_context.pipeline_cache, vk_context.swapchain_ctx.surface_format.format,
+                                 vk_context.swapchain_ctx.extent.width, vk_context.swapchain_ctx.extent.height);
+    vk_context.frames = init_frames(vk_context.device, frames_in_flight);
+    VK_CHECK(vk_lib::frame_context_init(&vk_context.frame_context, vkCreateSemaphore, vk_context.device, frames_in_flight));
+
+    // everything is recorded on this thread
+    const uint32_t queue_family = vk_context.graphics_present_queue_family;
+    uint32_t       recording_thread{};
+    VK_CHECK(vk_lib::command_allocator_init(&vk_context.command_allocator, vkCreateCommandPool, vk_context.device, {&queue_family, 1}, 1,
+                                            vk_context.frames.size()));
+    VK_CHECK(vk_lib::command_allocator_register_thread(&vk_context.command_allocator, &recording_thread));
+
+    const VkRect2D     render_area = vk_lib::rect_2d(vk_context.swapchain_ctx.extent);
+    const VkClearValue clear_value{};
     while (!glfwWindowShouldClose(vk_context.window)) {
         glfwPollEvents();
         int width, height;
@@ -402,24 +446,40 @@ int main() {
             glfwGetFramebufferSize(vk_context.window, &width, &height);
             glfwWaitEvents();
         }
-        const uint32_t           frame_index            = vk_context.curr_frame % 3;
-        const Frame*             current_frame          = &vk_context.frames[frame_index];
-        std::array               color_attachment_infos = {current_frame->attachment_info};
-        const VkRenderingInfoKHR rendering_info         = vk_lib::rendering_info(render_area, color_attachment_infos);
-
-        VkCommandBuffer command_buffer = current_frame->command_buffer;
+        uint32_t frame_index;
+        VK_CHECK(vk_lib::frame_context_begin(&vk_context.frame_context, vkWaitSemaphores, vk_context.device, &frame_index));
+        Frame* current_frame = &vk_context.frames[frame_index];
 
-        VK_CHECK(vkWaitForFences(vk_context.device, 1, &current_frame->in_flight_fence, true, UINT64_MAX));
-        VK_CHECK(vkResetFences(vk_context.device, 1, &current_frame->in_flight_fence));
+        // the frame's previous command buffers have completed, so its pools are reset as a whole
+        VK_CHECK(vk_lib::command_allocator_reset_frame(&vk_context.command_allocator, vkResetCommandPool, vk_context.device, frame_index));
+        VkCommandBuffer command_buffer;
+        VK_CHECK(vk_lib::command_allocator_allocate(&vk_context.command_allocator, vkAllocateCommandBuffers, vk_context.device, recording_thread,
+                                                    queue_family, frame_index, VK_COMMAND_BUFFER_LEVEL_PRIMARY, &command_buffer));
+        current_frame->command_buffer_submit_info = vk_lib::command_buffer_submit_info(command_buffer);
 
         uint32_t swapchain_image_index;
         vkAcquireNextImageKHR(vk_context.device, vk_context.swapchain_ctx.swapchain, UINT64_MAX, current_frame->image_available_semaphore, nullptr,
                               &swapchain_image_index);
-        VK_CHECK(vkResetCommandBuffer(command_buffer, 0));
+
+        // the acquire semaphore is waited on at COLOR_ATTACHMENT_OUTPUT, so the first transition only needs to wait for that stage
+        vk_lib::RenderGraph* render_graph = &vk_context.render_graph;
+        vk_lib::render_graph_clear(render_graph);
+        const uint32_t swapchain_image = vk_lib::render_graph_import_image(
+            render_graph, vk_context.swapchain_ctx.images[swapchain_image_index], vk_context.swapchain_ctx.image_views[swapchain_image_index],
+            vk_lib::image_subresource_range(VK_IMAGE_ASPECT_COLOR_BIT), VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR,
+            VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT, VK_ACCESS_2_NONE);
+        const uint32_t triangle_pass = vk_lib::render_graph_add_pass(render_graph, "triangle", render_area);
+        vk_lib::render_graph_color_attachment(render_graph, triangle_pass, swapchain_image, VK_ATTACHMENT_LOAD_OP_CLEAR, VK_ATTACHMENT_STORE_OP_STORE,
+                                              &clear_value);
+        vk_lib::render_graph_compile(render_graph);
 
         VkCommandBufferBeginInfo begin_info = vk_lib::command_buffer_begin_info(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
         VK_CHECK(vkBeginCommandBuffer(command_buffer, &begin_info));
 
+        const VkDependencyInfoKHR pass_dependency_info = vk_lib::render_graph_pass_dependency_info(render_graph, triangle_pass);
+        vkCmdPipelineBarrier2(command_buffer, &pass_dependency_info);
+
+        const VkRenderingInfoKHR rendering_info = vk_lib::render_graph_rendering_info(render_graph, triangle_pass);
         vkCmdBeginRenderingKHR(command_buffer, &rendering_info);
 
         vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vk_context.graphics_pipeline.pipeline);
@@ -428,18 +488,18 @@ int main() {
 
         vkCmdEndRenderingKHR(command_buffer);
 
-        vkCmdPipelineBarrier2(command_buffer, &current_frame->dependency_info);
+        const VkDependencyInfoKHR final_dependency_info = vk_lib::render_graph_final_dependency_info(render_graph);
+        vkCmdPipelineBarrier2(command_buffer, &final_dependency_info);
 
         VK_CHECK(vkEndCommandBuffer(command_buffer));
 
-        VK_CHECK(vkQueueSubmit2(vk_context.graphics_queue, 1, &current_frame->submit_info_2, current_frame->in_flight_fence));
+        current_frame->signal_semaphore_submit_infos[1] = vk_lib::frame_context_signal_info(&vk_context.frame_context);
+        VK_CHECK(vkQueueSubmit2(vk_context.graphics_queue, 1, &current_frame->submit_info_2, nullptr));
 
         VkPresentInfoKHR present =
             vk_lib::present_info(&vk_context.swapchain_ctx.swapchain, &swapchain_image_index, &current_frame->render_finished_semaphore);
 
         vkQueuePresentKHR(vk_context.present_queue, &present);
-
-        vk_context.curr_frame++;
     }
     destroy_resources(&vk_context);
 }
\ No newline at end of file
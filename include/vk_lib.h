@@ -1,10 +1,22 @@
 #pragma once
+#include <vk_lib/barriers.h>
 #include <vk_lib/commands.h>
 #include <vk_lib/core.h>
+#include <vk_lib/counters.h>
+#include <vk_lib/descriptors.h>
+#include <vk_lib/jobs.h>
+#include <vk_lib/memory.h>
+#include <vk_lib/object_caches.h>
+#include <vk_lib/pipeline_cache.h>
+#include <vk_lib/pipeline_compiler.h>
 #include <vk_lib/pipelines.h>
 #include <vk_lib/presentation.h>
+#include <vk_lib/queries.h>
+#include <vk_lib/queues.h>
+#include <vk_lib/render_graph.h>
 #include <vk_lib/rendering.h>
 #include <vk_lib/resources.h>
 #include <vk_lib/shader_data.h>
 #include <vk_lib/shaders.h>
 #include <vk_lib/synchronization.h>
+#include <vk_lib/transfers.h>
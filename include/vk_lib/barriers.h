@@ -0,0 +1,49 @@
+/*
+ * Utilities regarding batching pipeline barriers
+ */
+
+#pragma once
+#include <vk_lib/common.h>
+
+namespace vk_lib {
+
+/*
+ * BARRIER BATCH
+ *
+ * Accumulates the barriers built with image_memory_barrier_2(), buffer_memory_barrier_2() and global_memory_barrier_2()
+ * so a command buffer issues one vkCmdPipelineBarrier2 per flush point instead of one per barrier. Every barrier in a
+ * batch executes at the flush point, so the batch MUST be flushed before recording a command that depends on it:
+ *
+ *   if (!vk_lib::barrier_batch_empty(&batch)) {
+ *       VkDependencyInfoKHR dependency_info = vk_lib::barrier_batch_dependency_info(&batch);
+ *       vkCmdPipelineBarrier2KHR(command_buffer, &dependency_info);
+ *       vk_lib::barrier_batch_clear(&batch);
+ *   }
+ */
+
+struct BarrierBatch {
+    std::vector<VkImageMemoryBarrier2KHR>  image_barriers{};
+    std::vector<VkBufferMemoryBarrier2KHR> buffer_barriers{};
+    std::vector<VkMemoryBarrier2KHR>       memory_barriers{};
+};
+
+// merges with a pending barrier on the same subresource range whose new layout is the barrier's old layout, keeping the
+// first old layout
+// barriers that neither change the layout nor transfer ownership are dropped when they have no stages or are between
+// reads only, execution only barriers with NONE accesses are kept
+void barrier_batch_add_image(BarrierBatch* batch, const VkImageMemoryBarrier2KHR* image_barrier);
+
+// merges with a pending barrier on the same buffer range, dropped like image barriers
+void barrier_batch_add_buffer(BarrierBatch* batch, const VkBufferMemoryBarrier2KHR* buffer_barrier);
+
+// all global barriers of a batch are merged into one, barriers without stages or between reads only are dropped
+void barrier_batch_add_memory(BarrierBatch* batch, const VkMemoryBarrier2KHR* memory_barrier);
+
+[[nodiscard]] bool barrier_batch_empty(const BarrierBatch* batch);
+
+// the returned structure points into batch and is valid until the batch is modified
+[[nodiscard]] VkDependencyInfoKHR barrier_batch_dependency_info(const BarrierBatch* batch, VkDependencyFlags dependency_flags = 0);
+
+void barrier_batch_clear(BarrierBatch* batch);
+
+} // namespace vk_lib
\ No newline at end of file
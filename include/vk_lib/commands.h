@@ -3,43 +3,218 @@
  */
 
 #pragma once
+#include <atomic>
 #include <vk_lib/common.h>
 
 namespace vk_lib {
 
-[[nodiscard]] VkCommandPoolCreateInfo command_pool_create_info(uint32_t queue_family_index, VkCommandPoolCreateFlags flags = 0);
+[[nodiscard]] constexpr VkCommandPoolCreateInfo command_pool_create_info(uint32_t queue_family_index, VkCommandPoolCreateFlags flags = 0) {
+    VkCommandPoolCreateInfo command_pool_create_info{};
+    command_pool_create_info.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    command_pool_create_info.queueFamilyIndex = queue_family_index;
+    command_pool_create_info.flags            = flags;
 
-[[nodiscard]] VkCommandBufferAllocateInfo command_buffer_allocate_info(VkCommandPool        command_pool,
-                                                                       VkCommandBufferLevel level                = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
-                                                                       uint32_t             command_buffer_count = 1);
+    return command_pool_create_info;
+}
 
-[[nodiscard]] VkCommandBufferBeginInfo command_buffer_begin_info(VkCommandBufferUsageFlags             flags            = 0,
-                                                                 const VkCommandBufferInheritanceInfo* inheritance_info = nullptr,
-                                                                 const void*                           pNext            = nullptr);
+[[nodiscard]] constexpr VkCommandBufferAllocateInfo
+command_buffer_allocate_info(VkCommandPool command_pool, VkCommandBufferLevel level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+                             uint32_t command_buffer_count = 1) {
+    VkCommandBufferAllocateInfo command_buffer_allocate_info{};
+    command_buffer_allocate_info.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    command_buffer_allocate_info.level              = level;
+    command_buffer_allocate_info.commandBufferCount = command_buffer_count;
+    command_buffer_allocate_info.commandPool        = command_pool;
 
-[[nodiscard]] VkSubmitInfo submit_info_batch(std::span<const VkCommandBuffer> command_buffers, std::span<const VkSemaphore> wait_semaphores = {},
-                                             std::span<const VkPipelineStageFlags> wait_semaphore_stage_flags = {},
-                                             std::span<const VkSemaphore> signal_semaphores = {}, const void* pNext = nullptr);
+    return command_buffer_allocate_info;
+}
 
-[[nodiscard]] VkSubmitInfo submit_info(const VkCommandBuffer* command_buffer, const VkSemaphore* wait_semaphore = nullptr,
-                                       const VkPipelineStageFlags* wait_semaphore_stage_flags = nullptr,
-                                       const VkSemaphore* signal_semaphore = nullptr, const void* pNext = nullptr);
+[[nodiscard]] constexpr VkCommandBufferBeginInfo command_buffer_begin_info(VkCommandBufferUsageFlags             flags            = 0,
+                                                                           const VkCommandBufferInheritanceInfo* inheritance_info = nullptr,
+                                                                           const void*                           pNext            = nullptr) {
+    VkCommandBufferBeginInfo command_buffer_begin_info{};
+    command_buffer_begin_info.sType            = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    command_buffer_begin_info.pNext            = pNext;
+    command_buffer_begin_info.flags            = flags;
+    command_buffer_begin_info.pInheritanceInfo = inheritance_info;
+
+    return command_buffer_begin_info;
+}
+
+// secondary command buffers recorded for dynamic rendering chain a VkCommandBufferInheritanceRenderingInfoKHR instead of a render pass
+[[nodiscard]] constexpr VkCommandBufferInheritanceInfo
+command_buffer_inheritance_info(VkRenderPass render_pass = nullptr, uint32_t subpass = 0, VkFramebuffer framebuffer = nullptr,
+                                VkBool32 occlusion_query_enable = false, VkQueryControlFlags query_flags = 0,
+                                VkQueryPipelineStatisticFlags pipeline_statistics = 0, const void* pNext = nullptr) {
+    VkCommandBufferInheritanceInfo inheritance_info{};
+    inheritance_info.sType                = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    inheritance_info.renderPass           = render_pass;
+    inheritance_info.subpass              = subpass;
+    inheritance_info.framebuffer          = framebuffer;
+    inheritance_info.occlusionQueryEnable = occlusion_query_enable;
+    inheritance_info.queryFlags           = query_flags;
+    inheritance_info.pipelineStatistics   = pipeline_statistics;
+    inheritance_info.pNext                = pNext;
+
+    return inheritance_info;
+}
+
+[[nodiscard]] constexpr VkSubmitInfo submit_info_batch(std::span<const VkCommandBuffer> command_buffers,
+                                                       std::span<const VkSemaphore>          wait_semaphores            = {},
+                                                       std::span<const VkPipelineStageFlags> wait_semaphore_stage_flags = {},
+                                                       std::span<const VkSemaphore> signal_semaphores = {}, const void* pNext = nullptr) {
+    VkSubmitInfo submit_info{};
+    submit_info.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.commandBufferCount   = command_buffers.size();
+    submit_info.pCommandBuffers      = command_buffers.data();
+    submit_info.waitSemaphoreCount   = wait_semaphores.size();
+    submit_info.pWaitSemaphores      = wait_semaphores.data();
+    submit_info.pWaitDstStageMask    = wait_semaphore_stage_flags.data();
+    submit_info.signalSemaphoreCount = signal_semaphores.size();
+    submit_info.pSignalSemaphores    = signal_semaphores.data();
+    submit_info.pNext                = pNext;
+
+    return submit_info;
+}
+
+[[nodiscard]] constexpr VkSubmitInfo submit_info(const VkCommandBuffer* command_buffer, const VkSemaphore* wait_semaphore = nullptr,
+                                                 const VkPipelineStageFlags* wait_semaphore_stage_flags = nullptr,
+                                                 const VkSemaphore* signal_semaphore = nullptr, const void* pNext = nullptr) {
+    VkSubmitInfo submit_info{};
+    submit_info.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.commandBufferCount   = command_buffer == nullptr ? 0 : 1;
+    submit_info.pCommandBuffers      = command_buffer;
+    submit_info.waitSemaphoreCount   = wait_semaphore == nullptr ? 0 : 1;
+    submit_info.pWaitSemaphores      = wait_semaphore;
+    submit_info.pWaitDstStageMask    = wait_semaphore_stage_flags;
+    submit_info.signalSemaphoreCount = signal_semaphore == nullptr ? 0 : 1;
+    submit_info.pSignalSemaphores    = signal_semaphore;
+    submit_info.pNext                = pNext;
+
+    return submit_info;
+}
 /*
  * CORE EXTENSIONS
  */
 
 // VULKAN 1.3
 
-[[nodiscard]] VkCommandBufferSubmitInfoKHR command_buffer_submit_info(VkCommandBuffer command_buffer, uint32_t device_mask = 0,
-                                                                      const void* pNext = nullptr);
+[[nodiscard]] constexpr VkCommandBufferSubmitInfoKHR command_buffer_submit_info(VkCommandBuffer command_buffer, uint32_t device_mask = 0,
+                                                                                const void* pNext = nullptr) {
+    VkCommandBufferSubmitInfoKHR command_buffer_submit_info{};
+    command_buffer_submit_info.sType         = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO_KHR;
+    command_buffer_submit_info.commandBuffer = command_buffer;
+    command_buffer_submit_info.deviceMask    = device_mask;
+    command_buffer_submit_info.pNext         = pNext;
+
+    return command_buffer_submit_info;
+}
+
+[[nodiscard]] constexpr VkSubmitInfo2KHR submit_info_2_batch(std::span<const VkCommandBufferSubmitInfoKHR> command_buffer_submit_infos,
+                                                             std::span<const VkSemaphoreSubmitInfoKHR>     wait_semaphores_submit_infos   = {},
+                                                             std::span<const VkSemaphoreSubmitInfoKHR>     signal_semaphores_submit_infos = {},
+                                                             VkSubmitFlagsKHR submit_flags = 0, const void* pNext = nullptr) {
+    VkSubmitInfo2KHR submit_info_2{};
+    submit_info_2.sType                    = VK_STRUCTURE_TYPE_SUBMIT_INFO_2_KHR;
+    submit_info_2.commandBufferInfoCount   = command_buffer_submit_infos.size();
+    submit_info_2.pCommandBufferInfos      = command_buffer_submit_infos.data();
+    submit_info_2.waitSemaphoreInfoCount   = wait_semaphores_submit_infos.size();
+    submit_info_2.pWaitSemaphoreInfos      = wait_semaphores_submit_infos.data();
+    submit_info_2.signalSemaphoreInfoCount = signal_semaphores_submit_infos.size();
+    submit_info_2.pSignalSemaphoreInfos    = signal_semaphores_submit_infos.data();
+    submit_info_2.flags                    = submit_flags;
+    submit_info_2.pNext                    = pNext;
+
+    return submit_info_2;
+}
+
+[[nodiscard]] constexpr VkSubmitInfo2KHR submit_info_2(const VkCommandBufferSubmitInfoKHR* command_buffer_submit_info,
+                                                       const VkSemaphoreSubmitInfoKHR*     wait_semaphores_submit_info   = nullptr,
+                                                       const VkSemaphoreSubmitInfoKHR*     signal_semaphores_submit_info = nullptr,
+                                                       VkSubmitFlagsKHR submit_flags = 0, const void* pNext = nullptr) {
+    VkSubmitInfo2KHR submit_info_2{};
+    submit_info_2.sType                    = VK_STRUCTURE_TYPE_SUBMIT_INFO_2_KHR;
+    submit_info_2.commandBufferInfoCount   = command_buffer_submit_info == nullptr ? 0 : 1;
+    submit_info_2.pCommandBufferInfos      = command_buffer_submit_info;
+    submit_info_2.waitSemaphoreInfoCount   = wait_semaphores_submit_info == nullptr ? 0 : 1;
+    submit_info_2.pWaitSemaphoreInfos      = wait_semaphores_submit_info;
+    submit_info_2.signalSemaphoreInfoCount = signal_semaphores_submit_info == nullptr ? 0 : 1;
+    submit_info_2.pSignalSemaphoreInfos    = signal_semaphores_submit_info;
+    submit_info_2.flags                    = submit_flags;
+    submit_info_2.pNext                    = pNext;
+
+    return submit_info_2;
+}
+
+// the formats MUST match the attachments of the rendering the secondary command buffer is executed in
+[[nodiscard]] constexpr VkCommandBufferInheritanceRenderingInfoKHR
+command_buffer_inheritance_rendering_info(std::span<const VkFormat> color_attachment_formats, VkFormat depth_attachment_format = VK_FORMAT_UNDEFINED,
+                                          VkFormat              stencil_attachment_format = VK_FORMAT_UNDEFINED,
+                                          VkSampleCountFlagBits rasterization_samples     = VK_SAMPLE_COUNT_1_BIT, VkRenderingFlagsKHR flags = 0,
+                                          uint32_t view_mask = 0, const void* pNext = nullptr) {
+    VkCommandBufferInheritanceRenderingInfoKHR inheritance_rendering_info{};
+    inheritance_rendering_info.sType                   = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO_KHR;
+    inheritance_rendering_info.colorAttachmentCount    = color_attachment_formats.size();
+    inheritance_rendering_info.pColorAttachmentFormats = color_attachment_formats.data();
+    inheritance_rendering_info.depthAttachmentFormat   = depth_attachment_format;
+    inheritance_rendering_info.stencilAttachmentFormat = stencil_attachment_format;
+    inheritance_rendering_info.rasterizationSamples    = rasterization_samples;
+    inheritance_rendering_info.flags                   = flags;
+    inheritance_rendering_info.viewMask                = view_mask;
+    inheritance_rendering_info.pNext                   = pNext;
+
+    return inheritance_rendering_info;
+}
+
+/*
+ * COMMAND ALLOCATOR
+ *
+ * Command pools are externally synchronized, so every thread recording in parallel needs pools of its own. The
+ * allocator keeps one pool per recording thread, queue family and frame in flight, and a thread only allocates from
+ * its own pools, so handing out command buffers takes no lock. A retired frame's pools are reset with one
+ * vkResetCommandPool each and their command buffers are handed out again instead of being reset one by one:
+ *
+ *   command_allocator_init()               once, creates every pool
+ *   command_allocator_register_thread()    once per recording thread
+ *   command_allocator_allocate()           while recording, with the calling thread's index
+ *   command_allocator_reset_frame()        once the frame that last used frame_index completed
+ */
+
+// aligned so threads allocating side by side don't share cache lines
+struct alignas(64) CommandPoolSlot {
+    VkCommandPool pool{};
+    // indexed by VkCommandBufferLevel, kept across resets
+    std::array<std::vector<VkCommandBuffer>, 2> command_buffers{};
+    std::array<uint32_t, 2>                     used_counts{};
+};
+
+struct CommandAllocator {
+    std::vector<uint32_t> queue_family_indices{};
+    uint32_t              thread_count{};
+    uint32_t              frame_count{};
+    // indexed by frame, then queue family, then thread
+    std::vector<CommandPoolSlot> slots{};
+    std::atomic<uint32_t>        registered_threads{};
+};
+
+// pools are created with VK_COMMAND_POOL_CREATE_TRANSIENT_BIT
+[[nodiscard]] VkResult command_allocator_init(CommandAllocator* allocator, PFN_vkCreateCommandPool create_command_pool, VkDevice device,
+                                              std::span<const uint32_t> queue_family_indices, uint32_t thread_count, uint32_t frame_count);
+
+// returns VK_ERROR_TOO_MANY_OBJECTS once thread_count threads registered
+[[nodiscard]] VkResult command_allocator_register_thread(CommandAllocator* allocator, uint32_t* thread_index);
+
+// returns a command buffer that is ready to begin, it stays valid until frame_index is reset
+// returns VK_ERROR_INITIALIZATION_FAILED for a queue family the allocator was not initialized with, or an out of range index
+[[nodiscard]] VkResult command_allocator_allocate(CommandAllocator* allocator, PFN_vkAllocateCommandBuffers allocate_command_buffers,
+                                                  VkDevice device, uint32_t thread_index, uint32_t queue_family_index, uint32_t frame_index,
+                                                  VkCommandBufferLevel level, VkCommandBuffer* command_buffer);
+
+// no thread may allocate for frame_index while it is reset
+[[nodiscard]] VkResult command_allocator_reset_frame(CommandAllocator* allocator, PFN_vkResetCommandPool reset_command_pool, VkDevice device,
+                                                     uint32_t frame_index);
 
-[[nodiscard]] VkSubmitInfo2KHR submit_info_2_batch(std::span<const VkCommandBufferSubmitInfoKHR> command_buffer_submit_infos,
-                                                   std::span<const VkSemaphoreSubmitInfoKHR>     wait_semaphores_submit_infos   = {},
-                                                   std::span<const VkSemaphoreSubmitInfoKHR>     signal_semaphores_submit_infos = {},
-                                                   VkSubmitFlagsKHR submit_flags = 0, const void* pNext = nullptr);
+// hands every pool over to the caller for destruction, destroying a pool frees its command buffers
+void command_allocator_release_pools(CommandAllocator* allocator, std::vector<VkCommandPool>* pools);
 
-[[nodiscard]] VkSubmitInfo2KHR submit_info_2(const VkCommandBufferSubmitInfoKHR* command_buffer_submit_info,
-                                             const VkSemaphoreSubmitInfoKHR*     wait_semaphores_submit_info   = nullptr,
-                                             const VkSemaphoreSubmitInfoKHR*     signal_semaphores_submit_info = nullptr,
-                                             VkSubmitFlagsKHR submit_flags = 0, const void* pNext = nullptr);
 } // namespace vk_lib
\ No newline at end of file
@@ -7,19 +7,66 @@
 
 namespace vk_lib {
 
-[[nodiscard]] VkApplicationInfo application_info(const char* app_name, const char* engine_name, uint32_t api_version,
-                                                 uint32_t app_version    = VK_MAKE_API_VERSION(0, 1, 0, 0),
-                                                 uint32_t engine_version = VK_MAKE_API_VERSION(0, 1, 0, 0));
+[[nodiscard]] constexpr VkApplicationInfo application_info(const char* app_name, const char* engine_name, uint32_t api_version,
+                                                           uint32_t app_version    = VK_MAKE_API_VERSION(0, 1, 0, 0),
+                                                           uint32_t engine_version = VK_MAKE_API_VERSION(0, 1, 0, 0)) {
+    VkApplicationInfo application_info{};
+    application_info.sType              = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    application_info.pApplicationName   = app_name;
+    application_info.pEngineName        = engine_name;
+    application_info.apiVersion         = api_version;
+    application_info.applicationVersion = app_version;
+    application_info.engineVersion      = engine_version;
 
-[[nodiscard]] VkInstanceCreateInfo instance_create_info(const VkApplicationInfo* app_info, std::span<const char*> layers = {},
-                                                        std::span<const char*> instance_extensions = {}, VkInstanceCreateFlags flags = 0,
-                                                        const void* pNext = nullptr);
+    return application_info;
+}
 
-[[nodiscard]] VkDeviceQueueCreateInfo device_queue_create_info(uint32_t family_index, std::span<const float> queue_priorities,
-                                                               VkDeviceQueueCreateFlags flags = 0, const void* pNext = nullptr);
+[[nodiscard]] constexpr VkInstanceCreateInfo instance_create_info(const VkApplicationInfo* app_info, std::span<const char*> layers = {},
+                                                                  std::span<const char*> instance_extensions = {}, VkInstanceCreateFlags flags = 0,
+                                                                  const void* pNext = nullptr) {
+    VkInstanceCreateInfo instance_create_info{};
+    instance_create_info.sType                   = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instance_create_info.pApplicationInfo        = app_info;
+    instance_create_info.enabledLayerCount       = layers.size();
+    instance_create_info.ppEnabledLayerNames     = layers.data();
+    instance_create_info.enabledExtensionCount   = instance_extensions.size();
+    instance_create_info.ppEnabledExtensionNames = instance_extensions.data();
+    instance_create_info.flags                   = flags;
+    instance_create_info.pNext                   = pNext;
 
-[[nodiscard]] VkDeviceCreateInfo device_create_info(std::span<const VkDeviceQueueCreateInfo> queue_create_infos,
-                                                    std::span<const char*> device_extensions = {}, const VkPhysicalDeviceFeatures* features = nullptr,
-                                                    const void* pNext = nullptr);
+    return instance_create_info;
+}
+
+[[nodiscard]] constexpr VkDeviceQueueCreateInfo device_queue_create_info(uint32_t family_index, std::span<const float> queue_priorities,
+                                                                         VkDeviceQueueCreateFlags flags = 0, const void* pNext = nullptr) {
+    VkDeviceQueueCreateInfo queue_create_info{};
+    queue_create_info.sType            = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queue_create_info.queueCount       = queue_priorities.size();
+    queue_create_info.queueFamilyIndex = family_index;
+    queue_create_info.pQueuePriorities = queue_priorities.data();
+    queue_create_info.flags            = flags;
+    queue_create_info.pNext            = pNext;
+
+    return queue_create_info;
+}
+
+// returns the family with the fewest capabilities besides required_flags, so dedicated transfer or compute families win over general ones
+[[nodiscard]] std::optional<uint32_t> find_queue_family_index(std::span<const VkQueueFamilyProperties> queue_family_properties,
+                                                              VkQueueFlags required_flags, VkQueueFlags excluded_flags = 0);
+
+[[nodiscard]] constexpr VkDeviceCreateInfo device_create_info(std::span<const VkDeviceQueueCreateInfo> queue_create_infos,
+                                                              std::span<const char*> device_extensions = {},
+                                                              const VkPhysicalDeviceFeatures* features = nullptr, const void* pNext = nullptr) {
+    VkDeviceCreateInfo device_create_info{};
+    device_create_info.sType                   = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    device_create_info.pQueueCreateInfos       = queue_create_infos.data();
+    device_create_info.queueCreateInfoCount    = queue_create_infos.size();
+    device_create_info.ppEnabledExtensionNames = device_extensions.data();
+    device_create_info.enabledExtensionCount   = device_extensions.size();
+    device_create_info.pEnabledFeatures        = features;
+    device_create_info.pNext                   = pNext;
+
+    return device_create_info;
+}
 
 } // namespace vk_lib
\ No newline at end of file
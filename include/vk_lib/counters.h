@@ -0,0 +1,78 @@
+/*
+ * Utilities regarding counting Vulkan API usage on the CPU
+ */
+
+#pragma once
+#include <atomic>
+#include <vk_lib/common.h>
+
+namespace vk_lib {
+
+/*
+ * COUNTERS
+ *
+ * Counts the work that goes through the library per thread, so a change that e.g. doubles the vkQueueSubmit2 calls of
+ * a frame shows up without a capture tool. Counting is opt-in: the library and the caller only count when built with
+ * VK_LIB_ENABLE_COUNTERS defined (the VK_LIB_ENABLE_COUNTERS CMake option), otherwise VK_LIB_COUNT() expands to
+ * nothing and the snapshots stay zero:
+ *
+ *   VK_LIB_COUNT(PipelineBinds, 1)     from any thread, e.g. next to the caller's own vkCmdBindPipeline
+ *   counters_frame()                   once per frame, returns what was counted since the previous call
+ *
+ * Every thread increments a table of its own without locking or atomic read-modify-writes, snapshots lock only to
+ * walk the tables. The counts of threads that exited are kept.
+ */
+
+enum class Counter : uint8_t {
+    // vkQueueSubmit2 calls
+    Submits,
+    // image, buffer and memory barriers added to barrier batches and built by upload queues, merged barriers count once
+    Barriers,
+    // counted by the caller, the library never binds pipelines itself
+    PipelineBinds,
+    DescriptorWrites,
+    // command buffers, descriptor sets and memory taken from the library's allocators
+    Allocations,
+    // Vulkan objects created through the function pointers the library is given
+    ObjectCreations,
+};
+
+constexpr uint32_t counter_count = 6;
+
+// aligned so threads counting at the same time don't share cache lines
+struct alignas(64) CounterTable {
+    std::array<std::atomic<uint64_t>, counter_count> counts{};
+};
+
+// indexed by Counter
+struct CounterSnapshot {
+    std::array<uint64_t, counter_count> counts{};
+};
+
+// the calling thread's table, registered on its first count
+inline thread_local CounterTable* thread_counter_table{};
+
+[[nodiscard]] CounterTable* register_counter_table();
+
+inline void counter_add(Counter counter, uint64_t amount) {
+    CounterTable*          table = thread_counter_table != nullptr ? thread_counter_table : register_counter_table();
+    std::atomic<uint64_t>& count = table->counts[static_cast<uint32_t>(counter)];
+    // only the owning thread writes, the atomic just keeps snapshots from other threads well defined
+    count.store(count.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+}
+
+#ifdef VK_LIB_ENABLE_COUNTERS
+#define VK_LIB_COUNT(counter, amount) ::vk_lib::counter_add(::vk_lib::Counter::counter, amount)
+#else
+#define VK_LIB_COUNT(counter, amount) static_cast<void>(0)
+#endif
+
+// the totals of every thread since the start of the program
+[[nodiscard]] CounterSnapshot counters_snapshot();
+
+// the counts since previous was taken, previous is then updated to the current totals
+[[nodiscard]] CounterSnapshot counters_frame(CounterSnapshot* previous);
+
+[[nodiscard]] const char* counter_name(Counter counter);
+
+} // namespace vk_lib
\ No newline at end of file
@@ -0,0 +1,255 @@
+/*
+ * Utilities regarding allocating and updating descriptor sets
+ */
+
+#pragma once
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vk_lib/common.h>
+
+namespace vk_lib {
+
+/*
+ * DESCRIPTOR ALLOCATOR
+ *
+ * Allocates descriptor sets from a growing list of pools, so maxSets and pool sizes don't have to be known up front.
+ * A pool that runs out is retired until the next reset and replaced with a bigger one. The descriptor counts of new
+ * pools follow the ratios given at creation, raised to the averages seen so far when sets report their layout's sizes.
+ *
+ * Keep one allocator per frame in flight and reset it once the frame's sets are no longer in use, which recycles
+ * every pool at once instead of freeing sets one by one.
+ */
+
+struct DescriptorTypeRatio {
+    VkDescriptorType type{};
+    float            descriptors_per_set{};
+};
+
+struct DescriptorAllocator {
+    std::vector<DescriptorTypeRatio> ratios{};
+    uint32_t                         sets_per_pool{};
+    uint32_t                         max_sets_per_pool{};
+    VkDescriptorPoolCreateFlags      pool_flags{};
+    // pools are allocated from back to front
+    std::vector<VkDescriptorPool> ready_pools{};
+    std::vector<VkDescriptorPool> full_pools{};
+    // totals of the sets that reported their layout's sizes
+    uint64_t                             observed_sets{};
+    std::map<VkDescriptorType, uint64_t> observed_descriptors{};
+};
+
+[[nodiscard]] DescriptorAllocator descriptor_allocator(std::span<const DescriptorTypeRatio> ratios, uint32_t initial_sets_per_pool = 64,
+                                                       uint32_t max_sets_per_pool = 4096, VkDescriptorPoolCreateFlags pool_flags = 0);
+
+// layout_sizes, the descriptors set_layout holds per type, tune the size of pools created later
+[[nodiscard]] VkResult descriptor_allocator_allocate(DescriptorAllocator* allocator, PFN_vkCreateDescriptorPool create_descriptor_pool,
+                                                     PFN_vkAllocateDescriptorSets allocate_descriptor_sets, VkDevice device,
+                                                     VkDescriptorSetLayout set_layout, VkDescriptorSet* descriptor_set,
+                                                     std::span<const VkDescriptorPoolSize> layout_sizes = {}, const void* pNext = nullptr);
+
+// every set allocated from allocator becomes invalid, none of them may still be in use by the device
+[[nodiscard]] VkResult descriptor_allocator_reset(DescriptorAllocator* allocator, PFN_vkResetDescriptorPool reset_descriptor_pool, VkDevice device);
+
+// hands every pool over to the caller for destruction, leaving the allocator empty
+void descriptor_allocator_release_pools(DescriptorAllocator* allocator, std::vector<VkDescriptorPool>* pools);
+
+/*
+ * BINDLESS HEAP
+ *
+ * One descriptor set holding large arrays of sampled images, storage images and storage buffers that shaders index
+ * into, so it is bound once per frame instead of once per draw. Resources get a slot in their array from a lock-free
+ * free list and writes to the set are queued from any thread, then applied together by bindless_heap_flush(). The set
+ * is created with VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT, slots can be written while frames using it are in flight:
+ *
+ *   bindless_heap_init()
+ *   create the set layout from bindless_heap_layout_bindings(), binding_flags and bindless_heap_layout_flags
+ *   create a pool from bindless_heap_pool_sizes() and bindless_heap_pool_flags, allocate descriptor_set from it
+ *
+ * A freed slot may be handed out and rewritten right away, so free it only once the device is done with the resource.
+ */
+
+enum class BindlessResourceType : uint8_t {
+    SampledImage,
+    StorageImage,
+    StorageBuffer,
+};
+
+inline constexpr uint32_t         bindless_resource_type_count = 3;
+inline constexpr VkDescriptorType bindless_descriptor_types[bindless_resource_type_count]{
+    VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,
+    VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+    VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+};
+inline constexpr VkDescriptorSetLayoutCreateFlags bindless_heap_layout_flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+inline constexpr VkDescriptorPoolCreateFlags      bindless_heap_pool_flags   = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
+
+// Treiber stack over slot indices, the head packs the top slot with a counter that changes on every update to rule out ABA
+struct BindlessSlotList {
+    std::unique_ptr<std::atomic<uint32_t>[]> next_slots{};
+    std::atomic<uint64_t>                    head{};
+    uint32_t                                 capacity{};
+};
+
+struct BindlessWrite {
+    BindlessResourceType   type{};
+    uint32_t               slot{};
+    VkDescriptorImageInfo  image_info{};
+    VkDescriptorBufferInfo buffer_info{};
+};
+
+struct BindlessHeap {
+    // the binding of each array is its BindlessResourceType
+    std::array<BindlessSlotList, bindless_resource_type_count>         slot_lists{};
+    std::array<VkDescriptorBindingFlags, bindless_resource_type_count> binding_flags{};
+    VkDescriptorSet                                                    descriptor_set{};
+    std::mutex                                                         write_mutex{};
+    std::vector<BindlessWrite>                                         pending_writes{};
+};
+
+void bindless_heap_init(BindlessHeap* heap, uint32_t sampled_image_count, uint32_t storage_image_count, uint32_t storage_buffer_count);
+
+[[nodiscard]] std::array<VkDescriptorSetLayoutBinding, bindless_resource_type_count> bindless_heap_layout_bindings(const BindlessHeap* heap);
+
+[[nodiscard]] std::array<VkDescriptorPoolSize, bindless_resource_type_count> bindless_heap_pool_sizes(const BindlessHeap* heap);
+
+// returns VK_ERROR_OUT_OF_POOL_MEMORY when every slot of the type is taken
+[[nodiscard]] VkResult bindless_heap_allocate(BindlessHeap* heap, BindlessResourceType type, uint32_t* slot);
+
+void bindless_heap_free(BindlessHeap* heap, BindlessResourceType type, uint32_t slot);
+
+void bindless_heap_write_image(BindlessHeap* heap, BindlessResourceType type, uint32_t slot, VkImageView image_view, VkImageLayout image_layout);
+
+void bindless_heap_write_buffer(BindlessHeap* heap, uint32_t slot, VkBuffer buffer, uint64_t offset = 0, uint64_t range = VK_WHOLE_SIZE);
+
+// applies the queued writes with one call, writes to consecutive slots share a VkWriteDescriptorSet and only the last write to a slot is kept
+void bindless_heap_flush(BindlessHeap* heap, PFN_vkUpdateDescriptorSets update_descriptor_sets, VkDevice device);
+
+/*
+ * DESCRIPTOR BUFFER
+ *
+ * With VK_EXT_descriptor_buffer descriptors are written straight into a host visible buffer and a set is just an
+ * offset into it, which replaces pools and VkDescriptorSet objects. Set layouts keep the bindings made with
+ * descriptor_set_layout_binding(), only created with descriptor_buffer_layout_flags, so both paths share declarations:
+ *
+ *   descriptor_buffer_set_layout()            once per set layout, queries its size and binding offsets
+ *   descriptor_buffer()                       over a mapped buffer created with a descriptor buffer usage
+ *   descriptor_buffer_allocate()              per set, gives the set's offset in the buffer
+ *   descriptor_buffer_write()                 per descriptor, writes it into the mapping with vkGetDescriptorEXT
+ *   vkCmdBindDescriptorBuffersEXT             with descriptor_buffer_binding_info()
+ *   vkCmdSetDescriptorBufferOffsetsEXT        with the set offsets
+ *
+ * Like the descriptor allocator, keep one buffer per frame in flight and reset it once the frame completed.
+ */
+
+inline constexpr VkDescriptorSetLayoutCreateFlags descriptor_buffer_layout_flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+
+struct DescriptorBufferBinding {
+    VkDescriptorType type{};
+    uint64_t         offset{};
+};
+
+struct DescriptorBufferSetLayout {
+    VkDescriptorSetLayout set_layout{};
+    uint64_t              size{};
+    // indexed by binding number
+    std::vector<DescriptorBufferBinding> bindings{};
+};
+
+struct DescriptorBuffer {
+    VkBuffer                                      buffer{};
+    void*                                         mapped_data{};
+    VkDeviceAddress                               device_address{};
+    uint64_t                                      size{};
+    uint64_t                                      used_size{};
+    VkBufferUsageFlags                            usage{};
+    VkPhysicalDeviceDescriptorBufferPropertiesEXT properties{};
+    // buffer descriptors are bigger when robustBufferAccess is enabled
+    bool robust_buffer_access{};
+};
+
+// bindings MUST be the bindings set_layout was created with
+[[nodiscard]] DescriptorBufferSetLayout descriptor_buffer_set_layout(PFN_vkGetDescriptorSetLayoutSizeEXT           get_set_layout_size,
+                                                                     PFN_vkGetDescriptorSetLayoutBindingOffsetEXT  get_binding_offset,
+                                                                     VkDevice                                      device,
+                                                                     VkDescriptorSetLayout                         set_layout,
+                                                                     std::span<const VkDescriptorSetLayoutBinding> bindings);
+
+// usage MUST be the usage buffer was created with, e.g. VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT
+[[nodiscard]] DescriptorBuffer descriptor_buffer(VkBuffer buffer, void* mapped_data, VkDeviceAddress device_address, uint64_t size,
+                                                 VkBufferUsageFlags usage, const VkPhysicalDeviceDescriptorBufferPropertiesEXT* properties,
+                                                 bool robust_buffer_access = false);
+
+// returns VK_ERROR_OUT_OF_POOL_MEMORY when the set does not fit in the rest of the buffer
+[[nodiscard]] VkResult descriptor_buffer_allocate(DescriptorBuffer* descriptor_buffer, const DescriptorBufferSetLayout* set_layout,
+                                                  uint64_t* set_offset);
+
+// the sets allocated so far MUST no longer be in use by the device
+void descriptor_buffer_reset(DescriptorBuffer* descriptor_buffer);
+
+// get_info->type MUST match the binding's descriptor type
+void descriptor_buffer_write(const DescriptorBuffer* descriptor_buffer, PFN_vkGetDescriptorEXT get_descriptor, VkDevice device,
+                             const DescriptorBufferSetLayout* set_layout, uint64_t set_offset, uint32_t binding,
+                             const VkDescriptorGetInfoEXT* get_info, uint32_t array_element = 0);
+
+[[nodiscard]] VkDescriptorBufferBindingInfoEXT descriptor_buffer_binding_info(const DescriptorBuffer* descriptor_buffer);
+
+/*
+ * UPDATE TEMPLATES
+ *
+ * Lays the bindings of a set layout out in one flat block of descriptor infos, so a whole set is updated from it with a
+ * single vkUpdateDescriptorSetWithTemplate call:
+ *
+ *   DescriptorTemplateLayout template_layout = descriptor_template_layout(bindings);
+ *   create the template from descriptor_update_template_create_info(template_layout.entries, set_layout)
+ *   std::vector<uint8_t> data(template_layout.data_size);
+ *   descriptor_template_write_image(&template_layout, data.data(), 0, descriptor_image_info(...));
+ *   vkUpdateDescriptorSetWithTemplate(device, descriptor_set, update_template, data.data());
+ *
+ * Inline uniform blocks take descriptorCount bytes at their offset, written directly by the caller.
+ */
+
+struct DescriptorTemplateLayout {
+    // one entry per binding, ordered by binding number
+    std::vector<VkDescriptorUpdateTemplateEntry> entries{};
+    size_t                                       data_size{};
+};
+
+[[nodiscard]] DescriptorTemplateLayout descriptor_template_layout(std::span<const VkDescriptorSetLayoutBinding> bindings);
+
+// returns where the infos of binding start in the data block. binding MUST be one of the bindings template_layout
+// was built from, as for the descriptor_template_write_*() functions below
+[[nodiscard]] size_t descriptor_template_offset(const DescriptorTemplateLayout* template_layout, uint32_t binding, uint32_t array_element = 0);
+
+void descriptor_template_write_image(const DescriptorTemplateLayout* template_layout, void* data, uint32_t binding, VkDescriptorImageInfo image_info,
+                                     uint32_t array_element = 0);
+
+void descriptor_template_write_buffer(const DescriptorTemplateLayout* template_layout, void* data, uint32_t binding,
+                                      VkDescriptorBufferInfo buffer_info, uint32_t array_element = 0);
+
+void descriptor_template_write_texel_buffer(const DescriptorTemplateLayout* template_layout, void* data, uint32_t binding,
+                                            VkBufferView texel_buffer_view, uint32_t array_element = 0);
+
+/*
+ * WRITE BATCH
+ *
+ * Collects writes, e.g. from write_descriptor_set(), and applies them with one vkUpdateDescriptorSets call per flush.
+ * The image, buffer and texel buffer infos are copied when a write is added, so they can be temporaries. Structures
+ * chained to a write (inline uniform blocks, acceleration structures) MUST stay alive until the flush.
+ */
+
+struct DescriptorWriteBatch {
+    std::vector<VkWriteDescriptorSet> writes{};
+    // where the infos of each write start, the pointers are patched in on flush once the arrays stopped growing
+    std::vector<size_t>                 info_offsets{};
+    std::vector<VkDescriptorImageInfo>  image_infos{};
+    std::vector<VkDescriptorBufferInfo> buffer_infos{};
+    std::vector<VkBufferView>           texel_buffer_views{};
+};
+
+void descriptor_write_batch_add(DescriptorWriteBatch* batch, const VkWriteDescriptorSet* write);
+
+// does nothing when the batch is empty
+void descriptor_write_batch_flush(DescriptorWriteBatch* batch, PFN_vkUpdateDescriptorSets update_descriptor_sets, VkDevice device);
+
+} // namespace vk_lib
\ No newline at end of file
@@ -0,0 +1,109 @@
+/*
+ * Utilities regarding spreading command recording across threads
+ */
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vk_lib/commands.h>
+#include <vk_lib/common.h>
+
+namespace vk_lib {
+
+/*
+ * JOB SYSTEM
+ *
+ * Every worker owns a deque of jobs. Jobs submitted from a worker land in its own deque and are taken back from the
+ * end that was pushed last, while idle workers steal from the other end of someone else's deque, so jobs that spawn
+ * more jobs keep their data on one core until another one runs dry. The thread that started the system gets a deque
+ * of its own and runs jobs while it waits, so it never sits idle either:
+ *
+ *   job_system_start()     once, the system MUST NOT move afterwards
+ *   job_system_submit()    from any thread, jobs submitted from outside the system go to the starting thread's deque
+ *   job_system_wait()      until the counter the jobs were submitted with reaches zero
+ *   job_system_stop()      finishes the queued jobs and joins the workers
+ *
+ * Jobs get the index of the thread running them, from 0 to queue_count - 1 and the starting thread's being the last.
+ * No two threads share an index, so it can be used as the thread index of a CommandAllocator created with
+ * thread_count = queue_count instead of registering threads. Other threads have no index and never run jobs, they only
+ * wait for the system's threads to run them.
+ */
+
+using Job = std::function<void(uint32_t thread_index)>;
+
+struct JobCounter {
+    std::atomic<uint32_t> remaining_jobs{};
+};
+
+struct QueuedJob {
+    Job         job{};
+    JobCounter* counter{};
+};
+
+// aligned so workers stealing from each other don't share cache lines
+struct alignas(64) JobQueue {
+    std::mutex            mutex{};
+    std::deque<QueuedJob> jobs{};
+};
+
+struct JobSystem {
+    std::vector<std::thread> workers{};
+    // one per worker, the last one belongs to the thread that started the system
+    std::unique_ptr<JobQueue[]> queues{};
+    uint32_t                    queue_count{};
+    std::atomic<uint32_t>       queued_jobs{};
+    std::mutex                  sleep_mutex{};
+    std::condition_variable     wake_condition{};
+    bool                        stopping{};
+};
+
+// worker_count 0 uses one worker per hardware thread besides the starting thread
+void job_system_start(JobSystem* job_system, uint32_t worker_count = 0);
+
+// finishes the queued jobs and joins the workers
+void job_system_stop(JobSystem* job_system);
+
+// counter MUST stay alive until job_system_wait() returned for it
+void job_system_submit(JobSystem* job_system, JobCounter* counter, Job job);
+
+// runs queued jobs on the calling thread until every job submitted with counter completed, threads outside of the system
+// only wait
+void job_system_wait(JobSystem* job_system, JobCounter* counter);
+
+/*
+ * PARALLEL RECORDING
+ *
+ * Splits recording into chunks that are recorded into secondary command buffers on the job system and executed from
+ * the primary in chunk order, so the result is the same as recording every chunk into the primary one after another:
+ *
+ *   VkCommandBufferInheritanceRenderingInfoKHR inheritance_rendering_info =
+ *       vk_lib::command_buffer_inheritance_rendering_info(color_formats, depth_format);
+ *   VkCommandBufferInheritanceInfo inheritance_info =
+ *       vk_lib::command_buffer_inheritance_info(nullptr, 0, nullptr, false, 0, 0, &inheritance_rendering_info);
+ *   vkCmdBeginRenderingKHR(primary_command_buffer, &rendering_info)    with VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT
+ *   vk_lib::record_secondary_command_buffers(..., VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT, &inheritance_info, ...)
+ *   vkCmdEndRenderingKHR(primary_command_buffer)
+ */
+
+struct SecondaryCommandFunctions {
+    PFN_vkAllocateCommandBuffers allocate_command_buffers{};
+    PFN_vkBeginCommandBuffer     begin_command_buffer{};
+    PFN_vkEndCommandBuffer       end_command_buffer{};
+    PFN_vkCmdExecuteCommands     cmd_execute_commands{};
+};
+
+using RecordChunk = std::function<void(VkCommandBuffer command_buffer, uint32_t chunk)>;
+
+// command_allocator MUST have been created with at least job_system->queue_count threads, the chunks use the job thread indices
+// returns VK_SUCCESS or the first other result any chunk got, in which case nothing is executed from primary_command_buffer
+[[nodiscard]] VkResult record_secondary_command_buffers(JobSystem* job_system, CommandAllocator* command_allocator,
+                                                        const SecondaryCommandFunctions* functions, VkDevice device, uint32_t queue_family_index,
+                                                        uint32_t frame_index, VkCommandBufferUsageFlags usage_flags,
+                                                        const VkCommandBufferInheritanceInfo* inheritance_info, uint32_t chunk_count,
+                                                        const RecordChunk& record_chunk, VkCommandBuffer primary_command_buffer);
+
+} // namespace vk_lib
\ No newline at end of file
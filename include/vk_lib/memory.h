@@ -0,0 +1,154 @@
+/*
+ * Utilities regarding device memory allocation and sub-allocation
+ */
+
+#pragma once
+#include <vk_lib/common.h>
+
+namespace vk_lib {
+
+[[nodiscard]] constexpr VkMemoryAllocateInfo memory_allocate_info(uint64_t allocation_size, uint32_t memory_type_index, const void* pNext = nullptr) {
+    VkMemoryAllocateInfo memory_allocate_info{};
+    memory_allocate_info.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    memory_allocate_info.allocationSize  = allocation_size;
+    memory_allocate_info.memoryTypeIndex = memory_type_index;
+    memory_allocate_info.pNext           = pNext;
+
+    return memory_allocate_info;
+}
+
+[[nodiscard]] constexpr VkMappedMemoryRange mapped_memory_range(VkDeviceMemory memory, uint64_t offset = 0, uint64_t size = VK_WHOLE_SIZE,
+                                                                const void* pNext = nullptr) {
+    VkMappedMemoryRange mapped_memory_range{};
+    mapped_memory_range.sType  = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+    mapped_memory_range.memory = memory;
+    mapped_memory_range.offset = offset;
+    mapped_memory_range.size   = size;
+    mapped_memory_range.pNext  = pNext;
+
+    return mapped_memory_range;
+}
+
+// returns the first memory type allowed by memory_type_bits that has all required flags, preferring one that also has the preferred flags
+[[nodiscard]] std::optional<uint32_t> find_memory_type_index(const VkPhysicalDeviceMemoryProperties* memory_properties, uint32_t memory_type_bits,
+                                                             VkMemoryPropertyFlags required_flags, VkMemoryPropertyFlags preferred_flags = 0);
+
+/*
+ * TLSF SUB-ALLOCATION
+ *
+ * Two-level segregated fit allocator that places buffers and images inside large VkDeviceMemory blocks.
+ * Like the rest of vk_lib, it never calls Vulkan. When tlsf_allocate() returns VK_ERROR_OUT_OF_DEVICE_MEMORY,
+ * allocate a block with memory_allocate_info(allocator.block_size, allocator.memory_type_index), pass it to
+ * tlsf_add_memory_block() and allocate again. Resources bigger than block_size should get their own block.
+ */
+
+inline constexpr uint32_t tlsf_sl_index_count_log2 = 5;
+inline constexpr uint32_t tlsf_sl_index_count      = 1u << tlsf_sl_index_count_log2;
+// sizes below 2^tlsf_fl_index_shift share the first level, split linearly into second level buckets
+inline constexpr uint32_t tlsf_fl_index_shift = tlsf_sl_index_count_log2 + 3;
+inline constexpr uint32_t tlsf_fl_index_count = 64 - tlsf_fl_index_shift + 1;
+inline constexpr uint32_t tlsf_null_index     = UINT32_MAX;
+
+// Optimal images may not share a bufferImageGranularity page with linear resources (buffers and linear images)
+enum class ResourceTiling : uint8_t {
+    Linear,
+    Optimal,
+};
+
+struct TlsfNode {
+    uint64_t offset{};
+    uint64_t size{};
+    uint32_t block{tlsf_null_index};
+    uint32_t prev_physical{tlsf_null_index};
+    uint32_t next_physical{tlsf_null_index};
+    uint32_t prev_free{tlsf_null_index};
+    uint32_t next_free{tlsf_null_index};
+    bool     free{};
+};
+
+struct TlsfMemoryBlock {
+    VkDeviceMemory memory{};
+    uint64_t       size{};
+    uint32_t       allocation_count{};
+};
+
+struct TlsfAllocation {
+    VkDeviceMemory memory{};
+    uint64_t       offset{};
+    uint64_t       size{};
+    uint32_t       node{tlsf_null_index};
+};
+
+struct TlsfStatistics {
+    uint64_t total_size{};
+    uint64_t used_size{};
+    uint64_t free_size{};
+    uint64_t largest_free_size{};
+    uint32_t block_count{};
+    uint32_t allocation_count{};
+    uint32_t free_range_count{};
+    // 0 when all free memory is one contiguous range, approaching 1 as it splinters into small ranges
+    float fragmentation{};
+};
+
+struct TlsfAllocator {
+    uint32_t                                                        memory_type_index{};
+    uint64_t                                                        block_size{};
+    uint64_t                                                        buffer_image_granularity{1};
+    uint64_t                                                        used_size{};
+    uint32_t                                                        allocation_count{};
+    uint64_t                                                        fl_bitmap{};
+    std::array<uint32_t, tlsf_fl_index_count>                       sl_bitmaps{};
+    std::array<uint32_t, tlsf_fl_index_count * tlsf_sl_index_count> free_heads{};
+    std::vector<TlsfMemoryBlock>                                    blocks{};
+    std::vector<TlsfNode>                                           nodes{};
+    std::vector<uint32_t>                                           unused_nodes{};
+};
+
+// buffer_image_granularity should come from VkPhysicalDeviceLimits::bufferImageGranularity
+[[nodiscard]] TlsfAllocator tlsf_allocator(uint32_t memory_type_index, uint64_t block_size, uint64_t buffer_image_granularity = 1);
+
+void tlsf_add_memory_block(TlsfAllocator* allocator, VkDeviceMemory memory, uint64_t size);
+
+// requirements should come from vkGetBufferMemoryRequirements / vkGetImageMemoryRequirements
+[[nodiscard]] VkResult tlsf_allocate(TlsfAllocator* allocator, const VkMemoryRequirements* requirements, ResourceTiling tiling,
+                                     TlsfAllocation* allocation);
+
+void tlsf_free(TlsfAllocator* allocator, const TlsfAllocation* allocation);
+
+// detaches blocks without live allocations and appends their memory to released_memory so they can be passed to vkFreeMemory
+void tlsf_release_empty_blocks(TlsfAllocator* allocator, std::vector<VkDeviceMemory>* released_memory);
+
+[[nodiscard]] TlsfStatistics tlsf_statistics(const TlsfAllocator* allocator);
+
+/*
+ * CORE EXTENSIONS
+ */
+
+// VULKAN 1.1
+
+[[nodiscard]] constexpr VkBindBufferMemoryInfo bind_buffer_memory_info(VkBuffer buffer, VkDeviceMemory memory, uint64_t memory_offset = 0,
+                                                                       const void* pNext = nullptr) {
+    VkBindBufferMemoryInfo bind_buffer_memory_info{};
+    bind_buffer_memory_info.sType        = VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_INFO;
+    bind_buffer_memory_info.buffer       = buffer;
+    bind_buffer_memory_info.memory       = memory;
+    bind_buffer_memory_info.memoryOffset = memory_offset;
+    bind_buffer_memory_info.pNext        = pNext;
+
+    return bind_buffer_memory_info;
+}
+
+[[nodiscard]] constexpr VkBindImageMemoryInfo bind_image_memory_info(VkImage image, VkDeviceMemory memory, uint64_t memory_offset = 0,
+                                                                     const void* pNext = nullptr) {
+    VkBindImageMemoryInfo bind_image_memory_info{};
+    bind_image_memory_info.sType        = VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_INFO;
+    bind_image_memory_info.image        = image;
+    bind_image_memory_info.memory       = memory;
+    bind_image_memory_info.memoryOffset = memory_offset;
+    bind_image_memory_info.pNext        = pNext;
+
+    return bind_image_memory_info;
+}
+
+} // namespace vk_lib
\ No newline at end of file
@@ -0,0 +1,134 @@
+/*
+ * Utilities regarding sharing Vulkan objects created from identical state
+ */
+
+#pragma once
+#include <unordered_map>
+#include <vk_lib/common.h>
+
+namespace vk_lib {
+
+/*
+ * OBJECT CACHE
+ *
+ * Maps the full contents of a create info, flattened into an ObjectKey, to the object created from it. Keys hash
+ * everything reachable from the create info and are compared byte for byte, so hash collisions never return the wrong
+ * object. Handles referenced by the state (shader modules, layouts, ...) are compared by value.
+ *
+ * Caches are not synchronized and do not own their objects, use object_cache_handles() to destroy them. Objects whose
+ * create info can't be keyed are created every time they are asked for, and are kept with the cached ones so they are
+ * destroyed the same way.
+ */
+
+struct ObjectKey {
+    std::vector<uint8_t> bytes{};
+    uint64_t             hash{};
+};
+
+template <typename Handle> struct ObjectCacheEntry {
+    std::vector<uint8_t> key_bytes{};
+    Handle               handle{};
+};
+
+template <typename Handle> struct ObjectCache {
+    std::unordered_map<uint64_t, std::vector<ObjectCacheEntry<Handle>>> buckets{};
+    uint32_t                                                            object_count{};
+    // objects created for create infos that could not be keyed, never returned again
+    std::vector<Handle> uncached{};
+};
+
+// returns a null handle when no object was created from the key's state
+template <typename Handle> [[nodiscard]] Handle object_cache_find(const ObjectCache<Handle>* cache, const ObjectKey* key) {
+    const auto bucket = cache->buckets.find(key->hash);
+    if (bucket == cache->buckets.end()) {
+        return Handle{};
+    }
+    for (const ObjectCacheEntry<Handle>& entry : bucket->second) {
+        if (entry.key_bytes == key->bytes) {
+            return entry.handle;
+        }
+    }
+    return Handle{};
+}
+
+template <typename Handle> void object_cache_insert(ObjectCache<Handle>* cache, ObjectKey key, Handle handle) {
+    ObjectCacheEntry<Handle> entry{};
+    entry.key_bytes = std::move(key.bytes);
+    entry.handle    = handle;
+    cache->buckets[key.hash].push_back(std::move(entry));
+    cache->object_count++;
+}
+
+template <typename Handle> void object_cache_handles(const ObjectCache<Handle>* cache, std::vector<Handle>* handles) {
+    for (const auto& [hash, entries] : cache->buckets) {
+        for (const ObjectCacheEntry<Handle>& entry : entries) {
+            handles->push_back(entry.handle);
+        }
+    }
+    handles->insert(handles->end(), cache->uncached.begin(), cache->uncached.end());
+}
+
+template <typename Handle> void object_cache_clear(ObjectCache<Handle>* cache) {
+    cache->buckets.clear();
+    cache->uncached.clear();
+    cache->object_count = 0;
+}
+
+/*
+ * PIPELINES
+ */
+
+using PipelineObjectCache = ObjectCache<VkPipeline>;
+
+// returns false when the create info chains a structure the key cannot describe, such pipelines have to bypass the cache
+// viewports and scissors are left out of the key when they are dynamic state
+[[nodiscard]] bool graphics_pipeline_key(const VkGraphicsPipelineCreateInfo* create_info, ObjectKey* key);
+
+// keys the fixed-function states by their addresses and state_hash instead of their contents, so they MUST be constants
+// that outlive the cache, e.g. the states of a StaticPipelineState with state_hash its hash
+[[nodiscard]] bool static_graphics_pipeline_key(const VkGraphicsPipelineCreateInfo* create_info, uint64_t state_hash, ObjectKey* key);
+
+[[nodiscard]] bool compute_pipeline_key(const VkComputePipelineCreateInfo* create_info, ObjectKey* key);
+
+// returns the cached pipeline for identical state, otherwise creates it through create_graphics_pipelines and caches it
+// pipelines that can't be keyed are created on every call and added to cache->uncached
+[[nodiscard]] VkResult object_cache_get_graphics_pipeline(PipelineObjectCache* cache, PFN_vkCreateGraphicsPipelines create_graphics_pipelines,
+                                                          VkDevice device, VkPipelineCache pipeline_cache,
+                                                          const VkGraphicsPipelineCreateInfo* create_info, VkPipeline* pipeline);
+
+// create_info and state_hash as for static_graphics_pipeline_key()
+[[nodiscard]] VkResult object_cache_get_static_graphics_pipeline(PipelineObjectCache* cache, PFN_vkCreateGraphicsPipelines create_graphics_pipelines,
+                                                                 VkDevice device, VkPipelineCache pipeline_cache,
+                                                                 const VkGraphicsPipelineCreateInfo* create_info, uint64_t state_hash,
+                                                                 VkPipeline* pipeline);
+
+[[nodiscard]] VkResult object_cache_get_compute_pipeline(PipelineObjectCache* cache, PFN_vkCreateComputePipelines create_compute_pipelines,
+                                                         VkDevice device, VkPipelineCache pipeline_cache,
+                                                         const VkComputePipelineCreateInfo* create_info, VkPipeline* pipeline);
+
+/*
+ * LAYOUTS
+ *
+ * Sharing layouts keeps the driver's object count down and makes pipeline layouts built from the same sets identical,
+ * so descriptor sets stay bound across pipeline changes. Descriptor set layout bindings are keyed in binding order,
+ * the order they are listed in does not matter.
+ */
+
+using DescriptorSetLayoutObjectCache = ObjectCache<VkDescriptorSetLayout>;
+using PipelineLayoutObjectCache      = ObjectCache<VkPipelineLayout>;
+
+// VkDescriptorSetLayoutBindingFlagsCreateInfo is the only structure that can be chained
+[[nodiscard]] bool descriptor_set_layout_key(const VkDescriptorSetLayoutCreateInfo* create_info, ObjectKey* key);
+
+[[nodiscard]] bool pipeline_layout_key(const VkPipelineLayoutCreateInfo* create_info, ObjectKey* key);
+
+// returns the cached layout for identical state, otherwise creates it and caches it
+// layouts that can't be keyed are created on every call and added to cache->uncached
+[[nodiscard]] VkResult object_cache_get_descriptor_set_layout(DescriptorSetLayoutObjectCache* cache,
+                                                              PFN_vkCreateDescriptorSetLayout create_descriptor_set_layout, VkDevice device,
+                                                              const VkDescriptorSetLayoutCreateInfo* create_info, VkDescriptorSetLayout* set_layout);
+
+[[nodiscard]] VkResult object_cache_get_pipeline_layout(PipelineLayoutObjectCache* cache, PFN_vkCreatePipelineLayout create_pipeline_layout,
+                                                        VkDevice device, const VkPipelineLayoutCreateInfo* create_info, VkPipelineLayout* layout);
+
+} // namespace vk_lib
\ No newline at end of file
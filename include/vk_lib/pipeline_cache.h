@@ -0,0 +1,41 @@
+/*
+ * Utilities regarding persisting pipeline caches between runs
+ */
+
+#pragma once
+#include <vk_lib/common.h>
+
+namespace vk_lib {
+
+/*
+ * PIPELINE CACHE FILE
+ *
+ * Keeps compiled pipelines on disk so only the first launch on a device and driver pays for compilation:
+ *
+ *   pipeline_cache_file_open()                         at startup, maps the file read only
+ *   pipeline_cache_create_info(cache_file.data)        passed to vkCreatePipelineCache
+ *   pipeline_cache_file_close()                        once the cache is created
+ *
+ *   vkMergePipelineCaches / vkGetPipelineCacheData     at shutdown, gathering every cache the pipelines were created with
+ *   pipeline_cache_file_write()
+ */
+
+struct PipelineCacheFile {
+    void*                    mapping{};
+    size_t                   mapping_size{};
+    std::span<const uint8_t> data{};
+};
+
+// true when data starts with a VkPipelineCacheHeaderVersionOne written by the device and driver described by properties
+[[nodiscard]] bool pipeline_cache_data_compatible(std::span<const uint8_t> data, const VkPhysicalDeviceProperties* properties);
+
+// returns VK_INCOMPLETE and leaves data empty when the file does not exist or was written by another device or driver
+[[nodiscard]] VkResult pipeline_cache_file_open(const char* path, const VkPhysicalDeviceProperties* properties, PipelineCacheFile* cache_file);
+
+void pipeline_cache_file_close(PipelineCacheFile* cache_file);
+
+// writes to a temporary file next to path and renames it over path, so an interrupted write never leaves a truncated cache
+// returns VK_ERROR_INITIALIZATION_FAILED when data is not compatible with the device and VK_ERROR_UNKNOWN when the file cannot be written
+[[nodiscard]] VkResult pipeline_cache_file_write(const char* path, std::span<const uint8_t> data, const VkPhysicalDeviceProperties* properties);
+
+} // namespace vk_lib
\ No newline at end of file
@@ -0,0 +1,51 @@
+/*
+ * Utilities regarding compiling batches of pipelines on worker threads
+ */
+
+#pragma once
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vk_lib/common.h>
+
+namespace vk_lib {
+
+/*
+ * PIPELINE COMPILER
+ *
+ * Splits batches of pipeline create infos across a pool of worker threads. The creation functions are passed in by the
+ * caller (e.g. vkCreateGraphicsPipelines as loaded by volk) and every worker calls them with the same VkPipelineCache,
+ * which MUST NOT have been created with VK_PIPELINE_CACHE_CREATE_EXTERNALLY_SYNCHRONIZED_BIT.
+ *
+ * The create infos, everything they point to and the output pipelines MUST stay alive until the batch completes.
+ */
+
+struct PipelineCompiler {
+    std::vector<std::thread>          workers{};
+    std::mutex                        mutex{};
+    std::condition_variable           condition{};
+    std::deque<std::function<void()>> jobs{};
+    bool                              stopping{};
+};
+
+// thread_count 0 uses one thread per hardware thread
+void pipeline_compiler_start(PipelineCompiler* compiler, uint32_t thread_count = 0);
+
+// finishes the queued batches and joins the workers
+void pipeline_compiler_stop(PipelineCompiler* compiler);
+
+// the future holds VK_SUCCESS or the first other result any worker got, on_complete is called with the same value on a worker thread
+// batch_size 0 splits create_infos so every worker gets several batches to balance out pipelines of different cost
+[[nodiscard]] std::future<VkResult>
+pipeline_compiler_create_graphics_pipelines(PipelineCompiler* compiler, PFN_vkCreateGraphicsPipelines create_graphics_pipelines, VkDevice device,
+                                            VkPipelineCache pipeline_cache, std::span<const VkGraphicsPipelineCreateInfo> create_infos,
+                                            std::span<VkPipeline> pipelines, std::function<void(VkResult)> on_complete = {}, uint32_t batch_size = 0);
+
+[[nodiscard]] std::future<VkResult>
+pipeline_compiler_create_compute_pipelines(PipelineCompiler* compiler, PFN_vkCreateComputePipelines create_compute_pipelines, VkDevice device,
+                                           VkPipelineCache pipeline_cache, std::span<const VkComputePipelineCreateInfo> create_infos,
+                                           std::span<VkPipeline> pipelines, std::function<void(VkResult)> on_complete = {}, uint32_t batch_size = 0);
+
+} // namespace vk_lib
\ No newline at end of file
@@ -7,85 +7,304 @@
 
 namespace vk_lib {
 
-[[nodiscard]] VkPipelineShaderStageCreateInfo pipeline_shader_stage_create_info(VkShaderStageFlagBits stage, VkShaderModule shader_module,
-                                                                                VkPipelineShaderStageCreateFlags flags               = 0,
-                                                                                const char*                      entry_point         = "main",
-                                                                                const VkSpecializationInfo*      specialization_info = nullptr,
-                                                                                const void*                      pNext               = nullptr);
+[[nodiscard]] constexpr VkPipelineShaderStageCreateInfo
+pipeline_shader_stage_create_info(VkShaderStageFlagBits stage, VkShaderModule shader_module, VkPipelineShaderStageCreateFlags flags = 0,
+                                  const char* entry_point = "main", const VkSpecializationInfo* specialization_info = nullptr,
+                                  const void* pNext = nullptr) {
+    VkPipelineShaderStageCreateInfo shader_stage_create_info{};
+    shader_stage_create_info.sType               = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    shader_stage_create_info.flags               = flags;
+    shader_stage_create_info.stage               = stage;
+    shader_stage_create_info.module              = shader_module;
+    shader_stage_create_info.pName               = entry_point;
+    shader_stage_create_info.pSpecializationInfo = specialization_info;
+    shader_stage_create_info.pNext               = pNext;
 
-[[nodiscard]] VkPipelineLayoutCreateInfo pipeline_layout_create_info(std::span<const VkDescriptorSetLayout> set_layouts          = {},
-                                                                     std::span<const VkPushConstantRange>   push_constant_ranges = {},
-                                                                     VkPipelineLayoutCreateFlags flags = 0, const void* pNext = nullptr);
+    return shader_stage_create_info;
+}
 
-[[nodiscard]] VkComputePipelineCreateInfo compute_pipeline_create_info(VkPipelineLayout layout, VkPipelineShaderStageCreateInfo stage,
-                                                                       VkPipelineCreateFlags flags = 0, VkPipeline base_pipeline = nullptr,
-                                                                       int32_t base_pipeline_index = 0, const void* pNext = nullptr);
+[[nodiscard]] constexpr VkPipelineLayoutCreateInfo pipeline_layout_create_info(std::span<const VkDescriptorSetLayout> set_layouts          = {},
+                                                                               std::span<const VkPushConstantRange>   push_constant_ranges = {},
+                                                                               VkPipelineLayoutCreateFlags flags = 0, const void* pNext = nullptr) {
+    VkPipelineLayoutCreateInfo pipeline_layout_create_info{};
+    pipeline_layout_create_info.sType                  = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipeline_layout_create_info.setLayoutCount         = set_layouts.size();
+    pipeline_layout_create_info.pSetLayouts            = set_layouts.data();
+    pipeline_layout_create_info.pushConstantRangeCount = push_constant_ranges.size();
+    pipeline_layout_create_info.pPushConstantRanges    = push_constant_ranges.data();
+    pipeline_layout_create_info.flags                  = flags;
+    pipeline_layout_create_info.pNext                  = pNext;
 
-[[nodiscard]] VkVertexInputBindingDescription vertex_input_binding_description(uint32_t binding, uint32_t stride, VkVertexInputRate input_rate);
+    return pipeline_layout_create_info;
+}
 
-[[nodiscard]] VkVertexInputAttributeDescription vertex_input_attribute_description(uint32_t binding, uint32_t location, VkFormat format,
-                                                                                   uint32_t offset);
+[[nodiscard]] constexpr VkComputePipelineCreateInfo compute_pipeline_create_info(VkPipelineLayout layout, VkPipelineShaderStageCreateInfo stage,
+                                                                                 VkPipelineCreateFlags flags = 0, VkPipeline base_pipeline = nullptr,
+                                                                                 int32_t base_pipeline_index = 0, const void* pNext = nullptr) {
+    VkComputePipelineCreateInfo compute_pipeline_create_info{};
+    compute_pipeline_create_info.sType              = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+    compute_pipeline_create_info.layout             = layout;
+    compute_pipeline_create_info.stage              = stage;
+    compute_pipeline_create_info.flags              = flags;
+    compute_pipeline_create_info.basePipelineHandle = base_pipeline;
+    compute_pipeline_create_info.basePipelineIndex  = base_pipeline_index;
+    compute_pipeline_create_info.pNext              = pNext;
 
-[[nodiscard]] VkPipelineVertexInputStateCreateInfo
+    return compute_pipeline_create_info;
+}
+
+[[nodiscard]] constexpr VkVertexInputBindingDescription vertex_input_binding_description(uint32_t binding, uint32_t stride,
+                                                                                         VkVertexInputRate input_rate) {
+    VkVertexInputBindingDescription input_binding_description{};
+    input_binding_description.binding   = binding;
+    input_binding_description.stride    = stride;
+    input_binding_description.inputRate = input_rate;
+
+    return input_binding_description;
+}
+
+[[nodiscard]] constexpr VkVertexInputAttributeDescription vertex_input_attribute_description(uint32_t binding, uint32_t location, VkFormat format,
+                                                                                             uint32_t offset) {
+    VkVertexInputAttributeDescription input_attribute_description{};
+    input_attribute_description.binding  = binding;
+    input_attribute_description.location = location;
+    input_attribute_description.format   = format;
+    input_attribute_description.offset   = offset;
+
+    return input_attribute_description;
+}
+
+[[nodiscard]] constexpr VkPipelineVertexInputStateCreateInfo
 pipeline_vertex_input_state_create_info(std::span<const VkVertexInputBindingDescription>   bindings   = {},
-                                        std::span<const VkVertexInputAttributeDescription> attributes = {}, const void* pNext = nullptr);
+                                        std::span<const VkVertexInputAttributeDescription> attributes = {}, const void* pNext = nullptr) {
+    VkPipelineVertexInputStateCreateInfo vertex_input_state_create_info{};
+    vertex_input_state_create_info.sType                           = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    vertex_input_state_create_info.vertexBindingDescriptionCount   = bindings.size();
+    vertex_input_state_create_info.pVertexBindingDescriptions      = bindings.data();
+    vertex_input_state_create_info.vertexAttributeDescriptionCount = attributes.size();
+    vertex_input_state_create_info.pVertexAttributeDescriptions    = attributes.data();
+    vertex_input_state_create_info.pNext                           = pNext;
+
+    return vertex_input_state_create_info;
+}
+
+[[nodiscard]] constexpr VkPipelineInputAssemblyStateCreateInfo pipeline_input_assembly_state_create_info(VkPrimitiveTopology topology,
+                                                                                                         bool primitive_restart_enabled = false) {
+    VkPipelineInputAssemblyStateCreateInfo input_assembly_state_create_info{};
+    input_assembly_state_create_info.sType                  = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    input_assembly_state_create_info.topology               = topology;
+    input_assembly_state_create_info.primitiveRestartEnable = primitive_restart_enabled;
+
+    return input_assembly_state_create_info;
+}
+
+[[nodiscard]] constexpr VkPipelineTessellationStateCreateInfo pipeline_tessellation_state_create_info(uint32_t    patch_control_points,
+                                                                                                      const void* pNext = nullptr) {
+    VkPipelineTessellationStateCreateInfo tessellation_state_create_info{};
+    tessellation_state_create_info.sType              = VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_STATE_CREATE_INFO;
+    tessellation_state_create_info.patchControlPoints = patch_control_points;
+    tessellation_state_create_info.pNext              = pNext;
 
-[[nodiscard]] VkPipelineInputAssemblyStateCreateInfo pipeline_input_assembly_state_create_info(VkPrimitiveTopology topology,
-                                                                                               bool                primitive_restart_enabled = false);
+    return tessellation_state_create_info;
+}
 
-[[nodiscard]] VkPipelineTessellationStateCreateInfo pipeline_tessellation_state_create_info(uint32_t    patch_control_points,
-                                                                                            const void* pNext = nullptr);
+[[nodiscard]] constexpr VkPipelineViewportStateCreateInfo
+pipeline_multi_viewport_state_create_info(std::span<const VkViewport> viewports, std::span<const VkRect2D> scissors, const void* pNext = nullptr) {
+    VkPipelineViewportStateCreateInfo viewport_state_create_info{};
+    viewport_state_create_info.sType         = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+    viewport_state_create_info.viewportCount = viewports.size();
+    viewport_state_create_info.pViewports    = viewports.data();
+    viewport_state_create_info.scissorCount  = scissors.size();
+    viewport_state_create_info.pScissors     = scissors.data();
+    viewport_state_create_info.pNext         = pNext;
 
-[[nodiscard]] VkPipelineViewportStateCreateInfo
-pipeline_multi_viewport_state_create_info(std::span<const VkViewport> viewports, std::span<const VkRect2D> scissors, const void* pNext = nullptr);
+    return viewport_state_create_info;
+}
 
-[[nodiscard]] VkPipelineViewportStateCreateInfo pipeline_viewport_state_create_info(const VkViewport* viewport, const VkRect2D* scissor,
-                                                                                    const void* pNext = nullptr);
+[[nodiscard]] constexpr VkPipelineViewportStateCreateInfo pipeline_viewport_state_create_info(const VkViewport* viewport, const VkRect2D* scissor,
+                                                                                              const void* pNext = nullptr) {
+    VkPipelineViewportStateCreateInfo viewport_state_create_info{};
+    viewport_state_create_info.sType         = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+    viewport_state_create_info.viewportCount = 1;
+    viewport_state_create_info.pViewports    = viewport;
+    viewport_state_create_info.scissorCount  = 1;
+    viewport_state_create_info.pScissors     = scissor;
+    viewport_state_create_info.pNext         = pNext;
 
-[[nodiscard]] VkPipelineRasterizationStateCreateInfo
+    return viewport_state_create_info;
+}
+
+[[nodiscard]] constexpr VkPipelineRasterizationStateCreateInfo
 pipeline_rasterization_state_create_info(VkPolygonMode polygon_mode, VkFrontFace front_face, VkCullModeFlags cull_mode = VK_CULL_MODE_NONE,
                                          bool depth_bias_enable = false, float depth_bias_constant_factor = 0, float depth_bias_slope_factor = 0,
                                          bool depth_clamp_enable = false, float depth_bias_clamp = 0, float line_width = 1,
-                                         bool rasterizer_discard_enable = false, const void* pNext = nullptr);
+                                         bool rasterizer_discard_enable = false, const void* pNext = nullptr) {
+    VkPipelineRasterizationStateCreateInfo rasterization_state_create_info{};
+    rasterization_state_create_info.sType                   = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    rasterization_state_create_info.polygonMode             = polygon_mode;
+    rasterization_state_create_info.cullMode                = cull_mode;
+    rasterization_state_create_info.frontFace               = front_face;
+    rasterization_state_create_info.lineWidth               = line_width;
+    rasterization_state_create_info.depthClampEnable        = depth_clamp_enable;
+    rasterization_state_create_info.depthBiasEnable         = depth_bias_enable;
+    rasterization_state_create_info.rasterizerDiscardEnable = rasterizer_discard_enable;
+    rasterization_state_create_info.depthBiasConstantFactor = depth_bias_constant_factor;
+    rasterization_state_create_info.depthBiasClamp          = depth_bias_clamp;
+    rasterization_state_create_info.depthBiasSlopeFactor    = depth_bias_slope_factor;
+    rasterization_state_create_info.pNext                   = pNext;
+
+    return rasterization_state_create_info;
+}
 
-[[nodiscard]] VkPipelineMultisampleStateCreateInfo
+[[nodiscard]] constexpr VkPipelineMultisampleStateCreateInfo
 pipeline_multisample_state_create_info(VkSampleCountFlagBits rasterization_samples, bool sample_shading_enable = false,
                                        float min_sample_shading = 1.0f, const VkSampleMask* sample_mask = nullptr,
-                                       bool alpha_to_coverage_enable = false, bool alpha_to_one_enable = false);
+                                       bool alpha_to_coverage_enable = false, bool alpha_to_one_enable = false) {
+    VkPipelineMultisampleStateCreateInfo multisample_state_create_info{};
+    multisample_state_create_info.sType                 = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+    multisample_state_create_info.rasterizationSamples  = rasterization_samples;
+    multisample_state_create_info.sampleShadingEnable   = sample_shading_enable;
+    multisample_state_create_info.minSampleShading      = min_sample_shading;
+    multisample_state_create_info.pSampleMask           = sample_mask;
+    multisample_state_create_info.alphaToCoverageEnable = alpha_to_coverage_enable;
+    multisample_state_create_info.alphaToOneEnable      = alpha_to_one_enable;
+
+    return multisample_state_create_info;
+}
 
-[[nodiscard]] VkStencilOpState stencil_op_state(VkStencilOp fail_op, VkStencilOp pass_op, VkStencilOp depth_fail_op, VkCompareOp compare_op,
-                                                uint32_t compare_mask, uint32_t write_mask, uint32_t reference);
+[[nodiscard]] constexpr VkStencilOpState stencil_op_state(VkStencilOp fail_op, VkStencilOp pass_op, VkStencilOp depth_fail_op, VkCompareOp compare_op,
+                                                          uint32_t compare_mask, uint32_t write_mask, uint32_t reference) {
+    VkStencilOpState stencil_op_state{};
+    stencil_op_state.failOp      = fail_op;
+    stencil_op_state.passOp      = pass_op;
+    stencil_op_state.depthFailOp = depth_fail_op;
+    stencil_op_state.compareOp   = compare_op;
+    stencil_op_state.compareMask = compare_mask;
+    stencil_op_state.writeMask   = write_mask;
+    stencil_op_state.reference   = reference;
 
-[[nodiscard]] VkPipelineDepthStencilStateCreateInfo
+    return stencil_op_state;
+}
+
+[[nodiscard]] constexpr VkPipelineDepthStencilStateCreateInfo
 pipeline_depth_stencil_state_create_info(bool depth_test_enable = false, bool depth_write_enable = false,
                                          VkCompareOp depth_compare_op = VK_COMPARE_OP_LESS_OR_EQUAL, bool depth_bounds_test_enable = false,
                                          bool stencil_test_enable = false, const VkStencilOpState* front = nullptr,
-                                         const VkStencilOpState* back = nullptr, float min_depth_bounds = 0.0f, float max_depth_bounds = 1.0f);
+                                         const VkStencilOpState* back = nullptr, float min_depth_bounds = 0.0f, float max_depth_bounds = 1.0f) {
+    VkPipelineDepthStencilStateCreateInfo depth_stencil_state_create_info{};
+    depth_stencil_state_create_info.sType                 = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+    depth_stencil_state_create_info.depthTestEnable       = depth_test_enable;
+    depth_stencil_state_create_info.depthWriteEnable      = depth_write_enable;
+    depth_stencil_state_create_info.depthCompareOp        = depth_compare_op;
+    depth_stencil_state_create_info.depthBoundsTestEnable = depth_bounds_test_enable;
+    depth_stencil_state_create_info.stencilTestEnable     = stencil_test_enable;
+    depth_stencil_state_create_info.front                 = front != nullptr ? *front : VkStencilOpState{};
+    depth_stencil_state_create_info.back                  = back != nullptr ? *back : VkStencilOpState{};
+    depth_stencil_state_create_info.minDepthBounds        = min_depth_bounds;
+    depth_stencil_state_create_info.maxDepthBounds        = max_depth_bounds;
+
+    return depth_stencil_state_create_info;
+}
 
-[[nodiscard]] VkPipelineColorBlendAttachmentState
+[[nodiscard]] constexpr VkPipelineColorBlendAttachmentState
 pipeline_color_blend_attachment_state(bool blend_enabled = false, VkBlendFactor src_color_blend_factor = VK_BLEND_FACTOR_SRC_ALPHA,
                                       VkBlendFactor dst_color_blend_factor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA,
                                       VkBlendOp color_blend_op = VK_BLEND_OP_ADD, VkBlendFactor src_alpha_blend_factor = VK_BLEND_FACTOR_ONE,
                                       VkBlendFactor dst_alpha_blend_factor = VK_BLEND_FACTOR_ZERO, VkBlendOp alpha_blend_op = VK_BLEND_OP_ADD,
                                       VkColorComponentFlags color_write_mask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT |
-                                                                               VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT);
+                                                                               VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT) {
+    VkPipelineColorBlendAttachmentState color_blend_attachment_state{};
+    color_blend_attachment_state.blendEnable         = blend_enabled;
+    color_blend_attachment_state.srcColorBlendFactor = src_color_blend_factor;
+    color_blend_attachment_state.dstColorBlendFactor = dst_color_blend_factor;
+    color_blend_attachment_state.colorBlendOp        = color_blend_op;
+    color_blend_attachment_state.srcAlphaBlendFactor = src_alpha_blend_factor;
+    color_blend_attachment_state.dstAlphaBlendFactor = dst_alpha_blend_factor;
+    color_blend_attachment_state.alphaBlendOp        = alpha_blend_op;
+    color_blend_attachment_state.colorWriteMask      = color_write_mask;
 
-[[nodiscard]] VkPipelineColorBlendStateCreateInfo
+    return color_blend_attachment_state;
+}
+
+[[nodiscard]] constexpr VkPipelineColorBlendStateCreateInfo
 pipeline_color_blend_state_create_info(std::span<const VkPipelineColorBlendAttachmentState> color_blend_attachment_states,
                                        bool logic_op_enable = false, VkLogicOp logic_op = VK_LOGIC_OP_COPY,
                                        std::array<float, 4> blend_constants = {0, 0, 0, 0}, VkPipelineColorBlendStateCreateFlags flags = 0,
-                                       const void* pNext = nullptr);
+                                       const void* pNext = nullptr) {
+    VkPipelineColorBlendStateCreateInfo color_blend_state_create_info{};
+    color_blend_state_create_info.sType             = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+    color_blend_state_create_info.logicOpEnable     = logic_op_enable;
+    color_blend_state_create_info.logicOp           = logic_op;
+    color_blend_state_create_info.flags             = flags;
+    color_blend_state_create_info.blendConstants[0] = blend_constants[0];
+    color_blend_state_create_info.blendConstants[1] = blend_constants[1];
+    color_blend_state_create_info.blendConstants[2] = blend_constants[2];
+    color_blend_state_create_info.blendConstants[3] = blend_constants[3];
+    color_blend_state_create_info.attachmentCount   = color_blend_attachment_states.size();
+    color_blend_state_create_info.pAttachments      = color_blend_attachment_states.data();
+    color_blend_state_create_info.pNext             = pNext;
+
+    return color_blend_state_create_info;
+}
+
+[[nodiscard]] constexpr VkPipelineDynamicStateCreateInfo pipeline_dynamic_state_create_info(std::span<const VkDynamicState> dynamic_states) {
+    VkPipelineDynamicStateCreateInfo dynamic_state_create_info{};
+    dynamic_state_create_info.sType             = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+    dynamic_state_create_info.dynamicStateCount = dynamic_states.size();
+    dynamic_state_create_info.pDynamicStates    = dynamic_states.data();
+
+    return dynamic_state_create_info;
+}
 
-[[nodiscard]] VkPipelineDynamicStateCreateInfo pipeline_dynamic_state_create_info(std::span<const VkDynamicState> dynamic_states);
+[[nodiscard]] constexpr VkGraphicsPipelineCreateInfo
+graphics_pipeline_create_info(VkPipelineLayout layout, VkRenderPass render_pass, std::span<const VkPipelineShaderStageCreateInfo> shader_stages,
+                              const VkPipelineVertexInputStateCreateInfo*   vertex_input_state,
+                              const VkPipelineInputAssemblyStateCreateInfo* input_assembly_state,
+                              const VkPipelineViewportStateCreateInfo*      viewport_state,
+                              const VkPipelineRasterizationStateCreateInfo* rasterization_state,
+                              const VkPipelineMultisampleStateCreateInfo*   multisample_state,
+                              const VkPipelineColorBlendStateCreateInfo*    color_blend_state,
+                              const VkPipelineDepthStencilStateCreateInfo*  depth_stencil_state = nullptr,
+                              const VkPipelineDynamicStateCreateInfo*       dynamic_state       = nullptr,
+                              const VkPipelineTessellationStateCreateInfo* tessellation_state = nullptr, VkPipelineCreateFlags flags = 0,
+                              uint32_t subpass_index = 0, VkPipeline base_pipeline = nullptr, int32_t base_pipeline_index = 0,
+                              const void* pNext = nullptr) {
 
-[[nodiscard]] VkGraphicsPipelineCreateInfo graphics_pipeline_create_info(
-    VkPipelineLayout layout, VkRenderPass render_pass, std::span<const VkPipelineShaderStageCreateInfo> shader_stages,
-    const VkPipelineVertexInputStateCreateInfo* vertex_input_state, const VkPipelineInputAssemblyStateCreateInfo* input_assembly_state,
-    const VkPipelineViewportStateCreateInfo* viewport_state, const VkPipelineRasterizationStateCreateInfo* rasterization_state,
-    const VkPipelineMultisampleStateCreateInfo* multisample_state, const VkPipelineColorBlendStateCreateInfo* color_blend_state,
-    const VkPipelineDepthStencilStateCreateInfo* depth_stencil_state = nullptr, const VkPipelineDynamicStateCreateInfo* dynamic_state = nullptr,
-    const VkPipelineTessellationStateCreateInfo* tessellation_state = nullptr, VkPipelineCreateFlags flags = 0, uint32_t subpass_index = 0,
-    VkPipeline base_pipeline = nullptr, int32_t base_pipeline_index = 0, const void* pNext = nullptr);
+    VkGraphicsPipelineCreateInfo graphics_pipeline_create_info{};
+    graphics_pipeline_create_info.sType               = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    graphics_pipeline_create_info.flags               = flags;
+    graphics_pipeline_create_info.stageCount          = shader_stages.size();
+    graphics_pipeline_create_info.pStages             = shader_stages.data();
+    graphics_pipeline_create_info.pVertexInputState   = vertex_input_state;
+    graphics_pipeline_create_info.pInputAssemblyState = input_assembly_state;
+    graphics_pipeline_create_info.pTessellationState  = tessellation_state;
+    graphics_pipeline_create_info.pViewportState      = viewport_state;
+    graphics_pipeline_create_info.pRasterizationState = rasterization_state;
+    graphics_pipeline_create_info.pMultisampleState   = multisample_state;
+    graphics_pipeline_create_info.pDepthStencilState  = depth_stencil_state;
+    graphics_pipeline_create_info.pColorBlendState    = color_blend_state;
+    graphics_pipeline_create_info.pDynamicState       = dynamic_state;
+    graphics_pipeline_create_info.layout              = layout;
+    graphics_pipeline_create_info.renderPass          = render_pass;
+    graphics_pipeline_create_info.subpass             = subpass_index;
+    graphics_pipeline_create_info.basePipelineHandle  = base_pipeline;
+    graphics_pipeline_create_info.basePipelineIndex   = base_pipeline_index;
+    graphics_pipeline_create_info.pNext               = pNext;
+
+    return graphics_pipeline_create_info;
+}
+
+[[nodiscard]] constexpr VkPipelineCacheCreateInfo pipeline_cache_create_info(std::span<const uint8_t> initial_data = {},
+                                                                             VkPipelineCacheCreateFlags flags = 0, const void* pNext = nullptr) {
+    VkPipelineCacheCreateInfo pipeline_cache_create_info{};
+    pipeline_cache_create_info.sType           = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    pipeline_cache_create_info.flags           = flags;
+    pipeline_cache_create_info.initialDataSize = initial_data.size();
+    pipeline_cache_create_info.pInitialData    = initial_data.data();
+    pipeline_cache_create_info.pNext           = pNext;
+
+    return pipeline_cache_create_info;
+}
 
 /*
  * CORE EXTENSIONS
@@ -93,9 +312,128 @@ pipeline_color_blend_state_create_info(std::span<const VkPipelineColorBlendAttac
 
 // VULKAN 1.3
 
-[[nodiscard]] VkPipelineRenderingCreateInfoKHR pipeline_rendering_create_info(std::span<const VkFormat> color_attachment_formats,
-                                                                              VkFormat                  depth_attachment_format = VK_FORMAT_UNDEFINED,
-                                                                              VkFormat stencil_attachment_format                = VK_FORMAT_UNDEFINED,
-                                                                              uint32_t view_mask = 0, const void* pNext = nullptr);
+[[nodiscard]] constexpr VkPipelineRenderingCreateInfoKHR pipeline_rendering_create_info(std::span<const VkFormat> color_attachment_formats,
+                                                                                        VkFormat depth_attachment_format   = VK_FORMAT_UNDEFINED,
+                                                                                        VkFormat stencil_attachment_format = VK_FORMAT_UNDEFINED,
+                                                                                        uint32_t view_mask = 0, const void* pNext = nullptr) {
+    VkPipelineRenderingCreateInfoKHR rendering_create_info{};
+    rendering_create_info.sType                   = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR;
+    rendering_create_info.viewMask                = view_mask;
+    rendering_create_info.colorAttachmentCount    = color_attachment_formats.size();
+    rendering_create_info.pColorAttachmentFormats = color_attachment_formats.data();
+    rendering_create_info.depthAttachmentFormat   = depth_attachment_format;
+    rendering_create_info.stencilAttachmentFormat = stencil_attachment_format;
+    rendering_create_info.pNext                   = pNext;
+
+    return rendering_create_info;
+}
+
+/*
+ * STATIC PIPELINE STATE
+ *
+ * Fixed-function state known at compile time, described by a constexpr StaticPipelineDesc and turned into create infos
+ * by StaticPipelineState. The create infos and the arrays they point to are constants of the program, so building a
+ * pipeline from them needs no temporaries, and their hash is computed by the compiler:
+ *
+ *   constexpr StaticPipelineDesc<1, 0> opaque_desc{...};
+ *   using OpaqueState = StaticPipelineState<opaque_desc>;
+ *
+ *   static_graphics_pipeline_create_info<OpaqueState>()        with the layout, shader stages and rendering formats
+ *   object_cache_get_static_graphics_pipeline()                with OpaqueState::hash instead of hashing the state
+ *
+ * The viewport and scissor are always dynamic state, with a single viewport.
+ */
+
+template <size_t ColorAttachmentCount, size_t DynamicStateCount> struct StaticPipelineDesc {
+    VkPrimitiveTopology   topology{VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST};
+    VkPolygonMode         polygon_mode{VK_POLYGON_MODE_FILL};
+    VkCullModeFlags       cull_mode{VK_CULL_MODE_NONE};
+    VkFrontFace           front_face{VK_FRONT_FACE_COUNTER_CLOCKWISE};
+    VkSampleCountFlagBits rasterization_samples{VK_SAMPLE_COUNT_1_BIT};
+    bool                  depth_test_enable{};
+    bool                  depth_write_enable{};
+    VkCompareOp           depth_compare_op{VK_COMPARE_OP_LESS_OR_EQUAL};
+
+    std::array<VkPipelineColorBlendAttachmentState, ColorAttachmentCount> color_blend_attachments{};
+    // in addition to the viewport and scissor
+    std::array<VkDynamicState, DynamicStateCount> dynamic_states{};
+};
+
+// FNV-1a over the bytes of value, the same hash ObjectKeys use
+[[nodiscard]] constexpr uint64_t fnv1a_append(uint64_t hash, uint64_t value) {
+    for (uint32_t i = 0; i < sizeof(value); i++) {
+        hash = (hash ^ ((value >> (i * 8)) & 0xff)) * 1099511628211ull;
+    }
+    return hash;
+}
+
+template <size_t ColorAttachmentCount, size_t DynamicStateCount>
+[[nodiscard]] constexpr uint64_t static_pipeline_desc_hash(const StaticPipelineDesc<ColorAttachmentCount, DynamicStateCount>& desc) {
+    uint64_t hash = 14695981039346656037ull;
+
+    hash = fnv1a_append(hash, desc.topology);
+    hash = fnv1a_append(hash, desc.polygon_mode);
+    hash = fnv1a_append(hash, desc.cull_mode);
+    hash = fnv1a_append(hash, desc.front_face);
+    hash = fnv1a_append(hash, desc.rasterization_samples);
+    hash = fnv1a_append(hash, desc.depth_test_enable);
+    hash = fnv1a_append(hash, desc.depth_write_enable);
+    hash = fnv1a_append(hash, desc.depth_compare_op);
+
+    hash = fnv1a_append(hash, ColorAttachmentCount);
+    for (const VkPipelineColorBlendAttachmentState& attachment : desc.color_blend_attachments) {
+        hash = fnv1a_append(hash, attachment.blendEnable);
+        hash = fnv1a_append(hash, attachment.srcColorBlendFactor);
+        hash = fnv1a_append(hash, attachment.dstColorBlendFactor);
+        hash = fnv1a_append(hash, attachment.colorBlendOp);
+        hash = fnv1a_append(hash, attachment.srcAlphaBlendFactor);
+        hash = fnv1a_append(hash, attachment.dstAlphaBlendFactor);
+        hash = fnv1a_append(hash, attachment.alphaBlendOp);
+        hash = fnv1a_append(hash, attachment.colorWriteMask);
+    }
+    hash = fnv1a_append(hash, DynamicStateCount);
+    for (VkDynamicState dynamic_state : desc.dynamic_states) {
+        hash = fnv1a_append(hash, dynamic_state);
+    }
+    return hash;
+}
+
+// desc MUST be a StaticPipelineDesc
+template <auto desc> struct StaticPipelineState {
+    static constexpr auto color_blend_attachments = desc.color_blend_attachments;
+    static constexpr auto dynamic_states          = [] {
+        std::array<VkDynamicState, desc.dynamic_states.size() + 2> dynamic_states{VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR};
+        for (size_t i = 0; i < desc.dynamic_states.size(); i++) {
+            dynamic_states[i + 2] = desc.dynamic_states[i];
+        }
+        return dynamic_states;
+    }();
+
+    // no vertex buffers, for vertices pulled from storage buffers
+    static constexpr VkPipelineVertexInputStateCreateInfo   vertex_input_state   = pipeline_vertex_input_state_create_info();
+    static constexpr VkPipelineInputAssemblyStateCreateInfo input_assembly_state = pipeline_input_assembly_state_create_info(desc.topology);
+    static constexpr VkPipelineViewportStateCreateInfo      viewport_state       = pipeline_viewport_state_create_info(nullptr, nullptr);
+    static constexpr VkPipelineRasterizationStateCreateInfo rasterization_state =
+        pipeline_rasterization_state_create_info(desc.polygon_mode, desc.front_face, desc.cull_mode);
+    static constexpr VkPipelineMultisampleStateCreateInfo  multisample_state = pipeline_multisample_state_create_info(desc.rasterization_samples);
+    static constexpr VkPipelineDepthStencilStateCreateInfo depth_stencil_state =
+        pipeline_depth_stencil_state_create_info(desc.depth_test_enable, desc.depth_write_enable, desc.depth_compare_op);
+    static constexpr VkPipelineColorBlendStateCreateInfo color_blend_state = pipeline_color_blend_state_create_info(color_blend_attachments);
+    static constexpr VkPipelineDynamicStateCreateInfo    dynamic_state     = pipeline_dynamic_state_create_info(dynamic_states);
+
+    static constexpr uint64_t hash = static_pipeline_desc_hash(desc);
+};
+
+// State MUST be a StaticPipelineState, pNext takes e.g. a VkPipelineRenderingCreateInfoKHR when rendering dynamically
+template <typename State>
+[[nodiscard]] constexpr VkGraphicsPipelineCreateInfo
+static_graphics_pipeline_create_info(VkPipelineLayout layout, VkRenderPass render_pass,
+                                     std::span<const VkPipelineShaderStageCreateInfo> shader_stages,
+                                     const VkPipelineVertexInputStateCreateInfo*      vertex_input_state = &State::vertex_input_state,
+                                     VkPipelineCreateFlags flags = 0, uint32_t subpass_index = 0, const void* pNext = nullptr) {
+    return graphics_pipeline_create_info(layout, render_pass, shader_stages, vertex_input_state, &State::input_assembly_state,
+                                         &State::viewport_state, &State::rasterization_state, &State::multisample_state, &State::color_blend_state,
+                                         &State::depth_stencil_state, &State::dynamic_state, nullptr, flags, subpass_index, nullptr, 0, pNext);
+}
 
 } // namespace vk_lib
\ No newline at end of file
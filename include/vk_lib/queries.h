@@ -0,0 +1,206 @@
+/*
+ * Utilities regarding query pools and measuring GPU work
+ */
+
+#pragma once
+#include <string>
+#include <vk_lib/common.h>
+
+namespace vk_lib {
+
+[[nodiscard]] constexpr VkQueryPoolCreateInfo query_pool_create_info(VkQueryType query_type, uint32_t query_count,
+                                                                     VkQueryPipelineStatisticFlags pipeline_statistics = 0,
+                                                                     VkQueryPoolCreateFlags flags = 0, const void* pNext = nullptr) {
+    VkQueryPoolCreateInfo query_pool_create_info{};
+    query_pool_create_info.sType              = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    query_pool_create_info.queryType          = query_type;
+    query_pool_create_info.queryCount         = query_count;
+    query_pool_create_info.pipelineStatistics = pipeline_statistics;
+    query_pool_create_info.flags              = flags;
+    query_pool_create_info.pNext              = pNext;
+
+    return query_pool_create_info;
+}
+
+/*
+ * GPU PROFILER
+ *
+ * Writes a timestamp at the start and end of named zones into a query pool per frame in flight. A frame's timestamps
+ * are read back when its query pool comes up again, frame_count frames later, when the frame is known to have
+ * completed, so reading them never waits on the GPU:
+ *
+ *   gpu_profiler_init()            once, with the frame count of e.g. a FrameContext
+ *   gpu_profiler_begin_frame()     first thing in the frame's first command buffer, once the frame index is free again
+ *   gpu_profiler_begin_zone()      zones nest, every begin MUST be matched by an end in the same frame
+ *   gpu_profiler_end_zone()
+ *   profiler.results               the zones of the frame frame_count frames back, e.g. passed to chrome_trace_json()
+ *
+ * Zones MUST be recorded from one thread, in the order the command buffers are submitted in, on a queue with
+ * timestampValidBits != 0.
+ */
+
+struct GpuZone {
+    const char* name{};
+    // the end timestamp is the query after it
+    uint32_t begin_query{};
+    uint32_t depth{};
+};
+
+struct GpuZoneResult {
+    const char* name{};
+    uint32_t    depth{};
+    uint64_t    frame_number{};
+    // in microseconds on the GPU's clock, so zones of different frames line up
+    double begin_us{};
+    double duration_us{};
+};
+
+struct GpuProfilerFrame {
+    VkQueryPool          query_pool{};
+    std::vector<GpuZone> zones{};
+    uint32_t             used_queries{};
+    uint64_t             frame_number{};
+};
+
+struct GpuProfiler {
+    std::vector<GpuProfilerFrame> frames{};
+    uint32_t                      queries_per_frame{};
+    // nanoseconds per tick, VkPhysicalDeviceLimits::timestampPeriod
+    double   timestamp_period{};
+    uint64_t timestamp_mask{};
+    uint32_t frame_index{};
+    uint64_t frame_number{};
+    // zones begun but not ended yet, UINT32_MAX for zones dropped because the pool was full
+    std::vector<uint32_t>      open_zones{};
+    std::vector<GpuZoneResult> results{};
+    std::vector<uint64_t>      query_data{};
+};
+
+[[nodiscard]] VkResult gpu_profiler_init(GpuProfiler* profiler, PFN_vkCreateQueryPool create_query_pool, VkDevice device, uint32_t frame_count,
+                                         uint32_t max_zones_per_frame, float timestamp_period, uint32_t timestamp_valid_bits);
+
+// reads back the results of the frame that last used frame_index and resets its queries, MUST be recorded outside of rendering
+// zones whose timestamps are not available yet are left out of the results
+[[nodiscard]] VkResult gpu_profiler_begin_frame(GpuProfiler* profiler, PFN_vkGetQueryPoolResults get_query_pool_results,
+                                                PFN_vkCmdResetQueryPool cmd_reset_query_pool, VkDevice device, VkCommandBuffer command_buffer,
+                                                uint32_t frame_index);
+
+// name MUST stay valid until the zone's results are no longer used, e.g. a string literal
+// zones beyond max_zones_per_frame are dropped
+void gpu_profiler_begin_zone(GpuProfiler* profiler, PFN_vkCmdWriteTimestamp2KHR cmd_write_timestamp_2, VkCommandBuffer command_buffer,
+                             const char* name, VkPipelineStageFlags2 stage_mask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT);
+
+void gpu_profiler_end_zone(GpuProfiler* profiler, PFN_vkCmdWriteTimestamp2KHR cmd_write_timestamp_2, VkCommandBuffer command_buffer,
+                           VkPipelineStageFlags2 stage_mask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT);
+
+// hands every query pool over to the caller for destruction
+void gpu_profiler_release_query_pools(GpuProfiler* profiler, std::vector<VkQueryPool>* query_pools);
+
+// begins a zone and ends it when going out of scope
+struct GpuProfilerScope {
+    GpuProfiler*                profiler{};
+    PFN_vkCmdWriteTimestamp2KHR cmd_write_timestamp_2{};
+    VkCommandBuffer             command_buffer{};
+
+    GpuProfilerScope(GpuProfiler* profiler, PFN_vkCmdWriteTimestamp2KHR cmd_write_timestamp_2, VkCommandBuffer command_buffer, const char* name)
+        : profiler(profiler), cmd_write_timestamp_2(cmd_write_timestamp_2), command_buffer(command_buffer) {
+        gpu_profiler_begin_zone(profiler, cmd_write_timestamp_2, command_buffer, name);
+    }
+    ~GpuProfilerScope() { gpu_profiler_end_zone(profiler, cmd_write_timestamp_2, command_buffer); }
+
+    GpuProfilerScope(const GpuProfilerScope&)            = delete;
+    GpuProfilerScope& operator=(const GpuProfilerScope&) = delete;
+};
+
+// appends the zones as complete events in the Chrome trace event format, which chrome://tracing and Perfetto open
+void chrome_trace_json(std::span<const GpuZoneResult> zones, std::string* json);
+
+/*
+ * PASS QUERIES
+ *
+ * Wraps a pass in a pipeline statistics query, an occlusion query or both, to find overdraw and wasted vertex work.
+ * Like the GPU profiler, every frame in flight has query pools of its own and results are read back frame_count frames
+ * later, so reading them never waits on the GPU:
+ *
+ *   pass_queries_init()            once, the device MUST have the pipelineStatisticsQuery feature enabled
+ *   pass_queries_begin_frame()     first thing in the frame's first command buffer, once the frame index is free again
+ *   pass_queries_begin_scope()     scopes MUST NOT nest, and MUST end within the rendering or render pass they began in
+ *   pass_queries_end_scope()
+ *   queries.results                the scopes of the frame frame_count frames back
+ *
+ * Statistics scopes MUST be recorded on a queue supporting graphics, as the pools count graphics stages.
+ */
+
+// the statistics in the order PipelineStatistics holds them, which is the order of their bits
+constexpr VkQueryPipelineStatisticFlags pass_statistics_flags =
+    VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_VERTICES_BIT | VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT |
+    VK_QUERY_PIPELINE_STATISTIC_CLIPPING_INVOCATIONS_BIT | VK_QUERY_PIPELINE_STATISTIC_CLIPPING_PRIMITIVES_BIT |
+    VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT | VK_QUERY_PIPELINE_STATISTIC_COMPUTE_SHADER_INVOCATIONS_BIT;
+
+struct PipelineStatistics {
+    uint64_t input_assembly_vertices{};
+    uint64_t vertex_shader_invocations{};
+    // primitives reaching clipping, and the primitives clipping outputs
+    uint64_t clipping_invocations{};
+    uint64_t clipping_primitives{};
+    uint64_t fragment_shader_invocations{};
+    uint64_t compute_shader_invocations{};
+};
+
+// UINT32_MAX for the query types the scope does not use
+struct PassQueryScope {
+    const char* name{};
+    uint32_t    statistics_query{};
+    uint32_t    occlusion_query{};
+};
+
+struct PassQueryResult {
+    const char*        name{};
+    uint64_t           frame_number{};
+    bool               has_statistics{};
+    PipelineStatistics statistics{};
+    bool               has_occlusion{};
+    uint64_t           samples_passed{};
+};
+
+struct PassQueryFrame {
+    VkQueryPool                 statistics_pool{};
+    VkQueryPool                 occlusion_pool{};
+    std::vector<PassQueryScope> scopes{};
+    uint32_t                    used_statistics_queries{};
+    uint32_t                    used_occlusion_queries{};
+    uint64_t                    frame_number{};
+};
+
+struct PassQueries {
+    std::vector<PassQueryFrame> frames{};
+    uint32_t                    max_scopes_per_frame{};
+    uint32_t                    frame_index{};
+    uint64_t                    frame_number{};
+    // index of the scope begun but not ended yet, UINT32_MAX when there is none
+    uint32_t                     open_scope{UINT32_MAX};
+    std::vector<PassQueryResult> results{};
+    std::vector<uint64_t>        query_data{};
+};
+
+[[nodiscard]] VkResult pass_queries_init(PassQueries* queries, PFN_vkCreateQueryPool create_query_pool, VkDevice device, uint32_t frame_count,
+                                         uint32_t max_scopes_per_frame);
+
+// reads back the results of the frame that last used frame_index and resets its queries, MUST be recorded outside of rendering
+// scopes whose queries are not available yet are left out of the results
+[[nodiscard]] VkResult pass_queries_begin_frame(PassQueries* queries, PFN_vkGetQueryPoolResults get_query_pool_results,
+                                                PFN_vkCmdResetQueryPool cmd_reset_query_pool, VkDevice device, VkCommandBuffer command_buffer,
+                                                uint32_t frame_index);
+
+// name MUST stay valid until the scope's results are no longer used, e.g. a string literal
+// occlusion_control_flags VK_QUERY_CONTROL_PRECISE_BIT counts exact samples instead of only whether any passed
+// query types beyond max_scopes_per_frame are dropped
+void pass_queries_begin_scope(PassQueries* queries, PFN_vkCmdBeginQuery cmd_begin_query, VkCommandBuffer command_buffer, const char* name,
+                              bool pipeline_statistics = true, bool occlusion = false, VkQueryControlFlags occlusion_control_flags = 0);
+
+void pass_queries_end_scope(PassQueries* queries, PFN_vkCmdEndQuery cmd_end_query, VkCommandBuffer command_buffer);
+
+// hands every query pool over to the caller for destruction
+void pass_queries_release_query_pools(PassQueries* queries, std::vector<VkQueryPool>* query_pools);
+
+} // namespace vk_lib
\ No newline at end of file
@@ -0,0 +1,155 @@
+/*
+ * Utilities regarding submitting work to queues
+ */
+
+#pragma once
+#include <memory>
+#include <mutex>
+#include <vk_lib/common.h>
+
+namespace vk_lib {
+
+/*
+ * QUEUE SETUP
+ *
+ * Picks a queue for every role, preferring families dedicated to compute or transfer so that work on them overlaps
+ * with rendering. Roles get queues of their own while their family has queues left and share the family's last one
+ * otherwise, so on hardware with a single family everything ends up on one queue:
+ *
+ *   queue_setup_init()                 with the graphics family the caller picked, e.g. one that can also present
+ *   setup.queue_create_infos           passed to device_create_info()
+ *   queue_setup_get_queues()           once the device exists, e.g. passed on to submit_batcher_init()
+ */
+
+enum class QueueRole : uint8_t {
+    Graphics,
+    // async compute, runs alongside graphics when the device has a separate queue for it
+    Compute,
+    Transfer,
+};
+
+constexpr uint32_t queue_role_count = 3;
+
+struct QueueLocation {
+    uint32_t family_index{};
+    uint32_t queue_index{};
+};
+
+struct QueueSetup {
+    // distinct queues, in the order their roles come in QueueRole
+    std::vector<QueueLocation> queues{};
+    // indexed by QueueRole, indices into queues
+    std::array<uint32_t, queue_role_count> role_queues{};
+    // the create infos point into queue_priorities, so the setup MUST NOT be copied
+    std::vector<VkDeviceQueueCreateInfo> queue_create_infos{};
+    std::vector<std::vector<float>>      queue_priorities{};
+};
+
+// priorities are indexed by QueueRole
+void queue_setup_init(QueueSetup* setup, std::span<const VkQueueFamilyProperties> queue_family_properties, uint32_t graphics_family,
+                      std::array<float, queue_role_count> priorities = {1.f, 1.f, 0.5f});
+
+[[nodiscard]] uint32_t queue_setup_family(const QueueSetup* setup, QueueRole role);
+
+// queues are in the same order as setup->queues, so role_queues also index into them
+void queue_setup_get_queues(const QueueSetup* setup, PFN_vkGetDeviceQueue get_device_queue, VkDevice device, std::vector<VkQueue>* queues);
+
+/*
+ * SUBMIT BATCHER
+ *
+ * Every vkQueueSubmit2 call carries a large fixed cost in the driver, so instead of each subsystem submitting on its
+ * own, submissions are queued up and flushed with a single call per queue:
+ *
+ *   submit_batcher_init()          once, with every queue that is submitted to
+ *   submit_batcher_enqueue()       from any thread, with a submit info built by submit_info_2() or submit_info_2_batch()
+ *   submit_batcher_flush()         once per queue and frame, or whenever the queued work has to start
+ *
+ * A flush keeps the submissions in the order they were enqueued in and merges a submission into the one before it when
+ * it waits for nothing and the earlier one signals nothing, so the merged submission waits and signals exactly as the
+ * two did in sequence. Only the flush call itself holds the queue's submit_mutex, other calls using the queue (e.g.
+ * vkQueuePresentKHR) MUST lock it too.
+ */
+
+// ranges into the queue's info arrays
+struct PendingSubmission {
+    VkSubmitFlagsKHR flags{};
+    const void*      pNext{};
+    uint32_t         wait_info_offset{};
+    uint32_t         wait_info_count{};
+    uint32_t         command_buffer_info_offset{};
+    uint32_t         command_buffer_info_count{};
+    uint32_t         signal_info_offset{};
+    uint32_t         signal_info_count{};
+};
+
+// aligned so threads enqueueing to different queues don't share cache lines
+struct alignas(64) SubmitQueue {
+    VkQueue    queue{};
+    std::mutex submit_mutex{};
+    // guards the pending submissions, which are swapped out before the submit call
+    std::mutex                                pending_mutex{};
+    std::vector<PendingSubmission>            submissions{};
+    std::vector<VkSemaphoreSubmitInfoKHR>     wait_infos{};
+    std::vector<VkCommandBufferSubmitInfoKHR> command_buffer_infos{};
+    std::vector<VkSemaphoreSubmitInfoKHR>     signal_infos{};
+};
+
+struct SubmitBatcher {
+    // indexed by the queue's position in the queues passed to submit_batcher_init()
+    std::unique_ptr<SubmitQueue[]> queues{};
+    uint32_t                       queue_count{};
+};
+
+void submit_batcher_init(SubmitBatcher* batcher, std::span<const VkQueue> queues);
+
+// the semaphore and command buffer infos are copied, pNext is not and MUST stay valid until the flush
+// submissions with a pNext chain are never merged
+void submit_batcher_enqueue(SubmitBatcher* batcher, uint32_t queue_index, const VkSubmitInfo2KHR* submit_info);
+
+// submits everything enqueued to queue_index before the call, fence is signalled once all of it completed
+// a flush with nothing enqueued still submits when given a fence
+[[nodiscard]] VkResult submit_batcher_flush(SubmitBatcher* batcher, PFN_vkQueueSubmit2KHR queue_submit_2, uint32_t queue_index,
+                                            VkFence fence = nullptr);
+
+/*
+ * ASYNC COMPUTE
+ *
+ * Routes work to the graphics or the async compute queue and orders it with one timeline semaphore per queue. Every
+ * submission signals the next value of its queue's timeline and can wait for values of either queue, so compute work
+ * such as particle simulation or post-processing overlaps with rasterization while still being ordered where needed:
+ *
+ *   uint64_t particles = vk_lib::async_compute_submit(&scheduler, vk_lib::QueueRole::Compute, &simulate_submit_info);
+ *   const vk_lib::ScheduledWait wait{vk_lib::QueueRole::Compute, particles, VK_PIPELINE_STAGE_2_VERTEX_INPUT_BIT};
+ *   uint64_t frame = vk_lib::async_compute_submit(&scheduler, vk_lib::QueueRole::Graphics, &draw_submit_info, {&wait, 1});
+ *   vk_lib::submit_batcher_flush()     for both queues
+ *
+ * When graphics and compute share a queue the semaphores still order the work, it just doesn't overlap. Resources
+ * used on both queues need VK_SHARING_MODE_CONCURRENT or queue family ownership transfers when the families differ.
+ */
+
+struct ScheduledWait {
+    QueueRole             queue{};
+    uint64_t              value{};
+    VkPipelineStageFlags2 stage_mask{};
+};
+
+struct AsyncComputeScheduler {
+    SubmitBatcher* batcher{};
+    // indexed by QueueRole, only Graphics and Compute are used
+    std::array<uint32_t, queue_role_count>    batcher_queues{};
+    std::array<VkSemaphore, queue_role_count> timeline_semaphores{};
+    // last value signaled by a submission on each queue
+    std::array<uint64_t, queue_role_count> timeline_values{};
+};
+
+// creates the two timeline semaphores, which are owned by the caller and destroyed after the device is idle
+// the queue indices index into the batcher's queues, e.g. setup->role_queues when it was initialized with queue_setup_get_queues()
+[[nodiscard]] VkResult async_compute_init(AsyncComputeScheduler* scheduler, PFN_vkCreateSemaphore create_semaphore, VkDevice device,
+                                          SubmitBatcher* batcher, uint32_t graphics_queue_index, uint32_t compute_queue_index);
+
+// enqueues submit_info on the role's queue with the waits and a signal of the queue's timeline added
+// returns the signaled value, MUST be called from one thread at a time so the values are enqueued in order
+[[nodiscard]] uint64_t async_compute_submit(AsyncComputeScheduler* scheduler, QueueRole queue, const VkSubmitInfo2KHR* submit_info,
+                                            std::span<const ScheduledWait> waits = {});
+
+} // namespace vk_lib
\ No newline at end of file
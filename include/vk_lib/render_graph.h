@@ -0,0 +1,168 @@
+/*
+ * Utilities regarding ordering passes and generating the barriers between them
+ */
+
+#pragma once
+#include <vk_lib/barriers.h>
+#include <vk_lib/common.h>
+
+namespace vk_lib {
+
+/*
+ * RENDER GRAPH
+ *
+ * Passes declare how they use the graph's resources and render_graph_compile() derives everything else:
+ *  - passes whose results never reach an imported resource and that have no side effects are culled
+ *  - the remaining passes are reordered so producers and consumers are as far apart as the dependencies allow
+ *  - each pass gets exactly the barriers and layout transitions its usages need, merged into one dependency info
+ *  - transient images whose lifetimes do not overlap are packed into the same memory, with the barriers that aliasing requires
+ *
+ * The graph only describes the frame, recording stays with the caller:
+ *
+ *   for (uint32_t pass : graph.pass_order) {
+ *       VkDependencyInfoKHR dependency_info = vk_lib::render_graph_pass_dependency_info(&graph, pass);
+ *       vkCmdPipelineBarrier2KHR(command_buffer, &dependency_info);
+ *       if (!graph.passes[pass].color_attachments.empty() || graph.passes[pass].has_depth_attachment) {
+ *           VkRenderingInfoKHR rendering_info = vk_lib::render_graph_rendering_info(&graph, pass);
+ *           vkCmdBeginRenderingKHR(command_buffer, &rendering_info);
+ *       }
+ *       ...
+ *   }
+ *   VkDependencyInfoKHR final_dependency_info = vk_lib::render_graph_final_dependency_info(&graph);
+ *   vkCmdPipelineBarrier2KHR(command_buffer, &final_dependency_info);
+ */
+
+enum class ResourceAccess : uint8_t {
+    Read,
+    // the pass replaces the whole contents, earlier contents may be discarded on a layout transition
+    Write,
+    ReadWrite,
+};
+
+enum class RenderGraphResourceType : uint8_t {
+    Image,
+    Buffer,
+};
+
+struct RenderGraphResource {
+    RenderGraphResourceType type{};
+    VkImage                 image{};
+    VkImageView             image_view{};
+    VkImageSubresourceRange subresource_range{};
+    VkBuffer                buffer{};
+    uint64_t                offset{};
+    uint64_t                size{};
+    // transient resources live only within the graph, their writers are culled when nothing reads them
+    bool                 transient{};
+    VkMemoryRequirements memory_requirements{};
+    // written by render_graph_compile() for transient images, VK_WHOLE_SIZE when every pass using the image was culled
+    uint64_t memory_offset{};
+    // state before the graph's first use of the resource and the state it is left in
+    VkImageLayout         initial_layout{};
+    VkPipelineStageFlags2 initial_stage_mask{};
+    VkAccessFlags2        initial_access_mask{};
+    VkImageLayout         final_layout{};
+    VkPipelineStageFlags2 final_stage_mask{};
+    VkAccessFlags2        final_access_mask{};
+};
+
+struct RenderGraphUsage {
+    uint32_t              resource{};
+    ResourceAccess        resource_access{};
+    VkImageLayout         layout{};
+    VkPipelineStageFlags2 stage_mask{};
+    VkAccessFlags2        access_mask{};
+};
+
+struct RenderGraphPass {
+    const char*                               name{};
+    VkRect2D                                  render_area{};
+    bool                                      has_side_effects{};
+    std::vector<RenderGraphUsage>             usages{};
+    std::vector<VkRenderingAttachmentInfoKHR> color_attachments{};
+    VkRenderingAttachmentInfoKHR              depth_attachment{};
+    bool                                      has_depth_attachment{};
+};
+
+struct RenderGraph {
+    std::vector<RenderGraphResource> resources{};
+    std::vector<RenderGraphPass>     passes{};
+    // written by render_graph_compile()
+    std::vector<uint32_t>     pass_order{};
+    std::vector<BarrierBatch> pass_barriers{};
+    BarrierBatch              final_barriers{};
+    uint64_t                  transient_memory_size{};
+    uint64_t                  transient_memory_alignment{};
+    uint32_t                  transient_memory_type_bits{};
+};
+
+// returns the resource index. imported resources outlive the graph, so passes writing them are never culled
+// final_layout VK_IMAGE_LAYOUT_UNDEFINED leaves the image in the layout of its last use
+[[nodiscard]] uint32_t render_graph_import_image(RenderGraph* graph, VkImage image, VkImageView image_view, VkImageSubresourceRange subresource_range,
+                                                 VkImageLayout         initial_layout,
+                                                 VkImageLayout         final_layout        = VK_IMAGE_LAYOUT_UNDEFINED,
+                                                 VkPipelineStageFlags2 initial_stage_mask  = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+                                                 VkAccessFlags2        initial_access_mask = VK_ACCESS_2_MEMORY_WRITE_BIT,
+                                                 VkPipelineStageFlags2 final_stage_mask    = VK_PIPELINE_STAGE_2_NONE,
+                                                 VkAccessFlags2        final_access_mask   = VK_ACCESS_2_NONE);
+
+[[nodiscard]] uint32_t render_graph_import_buffer(RenderGraph* graph, VkBuffer buffer, uint64_t offset = 0, uint64_t size = VK_WHOLE_SIZE,
+                                                  VkPipelineStageFlags2 initial_stage_mask  = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+                                                  VkAccessFlags2        initial_access_mask = VK_ACCESS_2_MEMORY_WRITE_BIT,
+                                                  VkPipelineStageFlags2 final_stage_mask    = VK_PIPELINE_STAGE_2_NONE,
+                                                  VkAccessFlags2        final_access_mask   = VK_ACCESS_2_NONE);
+
+// returns the pass index. passes with side effects (e.g. readbacks) are never culled
+[[nodiscard]] uint32_t render_graph_add_pass(RenderGraph* graph, const char* name, VkRect2D render_area = {}, bool has_side_effects = false);
+
+// a pass MUST use each image in a single layout, repeated usages of a resource are merged
+void render_graph_use_image(RenderGraph* graph, uint32_t pass, uint32_t resource, ResourceAccess resource_access, VkImageLayout layout,
+                            VkPipelineStageFlags2 stage_mask, VkAccessFlags2 access_mask);
+
+void render_graph_use_buffer(RenderGraph* graph, uint32_t pass, uint32_t resource, ResourceAccess resource_access, VkPipelineStageFlags2 stage_mask,
+                             VkAccessFlags2 access_mask);
+
+// attachments are added to the pass's rendering info in call order
+void render_graph_color_attachment(RenderGraph* graph, uint32_t pass, uint32_t resource, VkAttachmentLoadOp load_op, VkAttachmentStoreOp store_op,
+                                   const VkClearValue* clear_value = nullptr);
+
+void render_graph_depth_attachment(RenderGraph* graph, uint32_t pass, uint32_t resource, VkAttachmentLoadOp load_op, VkAttachmentStoreOp store_op,
+                                   const VkClearValue* clear_value = nullptr);
+
+void render_graph_compile(RenderGraph* graph);
+
+// the returned structures point into graph and are valid until it is modified
+[[nodiscard]] VkDependencyInfoKHR render_graph_pass_dependency_info(const RenderGraph* graph, uint32_t pass);
+
+[[nodiscard]] VkDependencyInfoKHR render_graph_final_dependency_info(const RenderGraph* graph);
+
+[[nodiscard]] VkRenderingInfoKHR render_graph_rendering_info(const RenderGraph* graph, uint32_t pass);
+
+// removes every resource and pass so the graph can be rebuilt for the next frame
+void render_graph_clear(RenderGraph* graph);
+
+/*
+ * TRANSIENT IMAGES
+ *
+ * Transient images hold intermediate results that are produced and consumed within one frame. The graph assigns each
+ * one an offset into a single allocation of transient_memory_size bytes, letting images that are never live at the
+ * same time share memory. An image can only be bound once, so the images and their memory are meant to be kept for as
+ * long as the graph is built the same way:
+ *
+ *   render_graph_add_transient_image()                 with an image created but not yet bound
+ *   render_graph_compile()
+ *   allocate transient_memory_size bytes from a type in transient_memory_type_bits (e.g. with tlsf_allocate())
+ *   render_graph_transient_bind_infos()                passed to vkBindImageMemory2
+ *
+ * When the memory is shared between frames in flight, a frame MUST not start before the previous one using it completed.
+ */
+
+// image MUST use optimal tiling and memory_requirements MUST be queried from it
+[[nodiscard]] uint32_t render_graph_add_transient_image(RenderGraph* graph, VkImage image, VkImageView image_view,
+                                                        VkImageSubresourceRange subresource_range, const VkMemoryRequirements* memory_requirements);
+
+// memory_offset MUST be a multiple of transient_memory_alignment
+void render_graph_transient_bind_infos(const RenderGraph* graph, VkDeviceMemory memory, uint64_t memory_offset,
+                                       std::vector<VkBindImageMemoryInfo>* bind_infos);
+
+} // namespace vk_lib
\ No newline at end of file
@@ -7,59 +7,272 @@
 
 namespace vk_lib {
 
-[[nodiscard]] VkPushConstantRange push_constant_range(VkShaderStageFlags shader_stage_flags, uint32_t size, uint32_t offset = 0);
+[[nodiscard]] constexpr VkPushConstantRange push_constant_range(VkShaderStageFlags shader_stage_flags, uint32_t size, uint32_t offset = 0) {
+    VkPushConstantRange push_constant_range{};
+    push_constant_range.stageFlags = shader_stage_flags;
+    push_constant_range.offset     = offset;
+    push_constant_range.size       = size;
 
-[[nodiscard]] VkSpecializationMapEntry specialization_map_entry(uint32_t constant_id, size_t size, uint32_t offset = 0);
+    return push_constant_range;
+}
 
-[[nodiscard]] VkSpecializationInfo specialization_info(const void* data, uint32_t data_size, std::span<const VkSpecializationMapEntry> map_entries);
+[[nodiscard]] constexpr VkSpecializationMapEntry specialization_map_entry(uint32_t constant_id, size_t size, uint32_t offset = 0) {
+    VkSpecializationMapEntry specialization_map_entry{};
+    specialization_map_entry.constantID = constant_id;
+    specialization_map_entry.offset     = offset;
+    specialization_map_entry.size       = size;
 
-[[nodiscard]] VkDescriptorSetLayoutBinding descriptor_set_layout_binding(uint32_t binding, VkDescriptorType type, uint32_t descriptor_count = 1,
-                                                                         VkShaderStageFlags stages            = VK_SHADER_STAGE_ALL,
-                                                                         const VkSampler*   immutable_sampler = nullptr);
+    return specialization_map_entry;
+}
 
-[[nodiscard]] VkDescriptorSetLayoutCreateInfo descriptor_set_layout_create_info(std::span<const VkDescriptorSetLayoutBinding> layout_bindings,
-                                                                                VkDescriptorSetLayoutCreateFlags              flags = 0,
-                                                                                const void*                                   pNext = nullptr);
+[[nodiscard]] constexpr VkSpecializationInfo specialization_info(const void* data, uint32_t data_size,
+                                                                 std::span<const VkSpecializationMapEntry> map_entries) {
+    VkSpecializationInfo specialization_info{};
+    specialization_info.mapEntryCount = map_entries.size();
+    specialization_info.pMapEntries   = map_entries.data();
+    specialization_info.dataSize      = data_size;
+    specialization_info.pData         = data;
 
-[[nodiscard]] VkDescriptorPoolSize descriptor_pool_size(VkDescriptorType type, uint32_t descriptor_count);
+    return specialization_info;
+}
 
-[[nodiscard]] VkDescriptorPoolCreateInfo descriptor_pool_create_info(uint32_t max_sets, std::span<const VkDescriptorPoolSize> pool_sizes,
-                                                                     VkDescriptorPoolCreateFlags flags = 0, const void* pNext = nullptr);
+[[nodiscard]] constexpr VkDescriptorSetLayoutBinding descriptor_set_layout_binding(uint32_t binding, VkDescriptorType type,
+                                                                                   uint32_t           descriptor_count  = 1,
+                                                                                   VkShaderStageFlags stages            = VK_SHADER_STAGE_ALL,
+                                                                                   const VkSampler*   immutable_sampler = nullptr) {
+    VkDescriptorSetLayoutBinding layout_binding{};
+    layout_binding.binding            = binding;
+    layout_binding.descriptorType     = type;
+    layout_binding.stageFlags         = stages;
+    layout_binding.descriptorCount    = descriptor_count;
+    layout_binding.pImmutableSamplers = immutable_sampler;
 
-[[nodiscard]] VkDescriptorSetAllocateInfo descriptor_set_allocate_info(const VkDescriptorSetLayout* set_layout, VkDescriptorPool descriptor_pool,
-                                                                       uint32_t descriptor_set_count = 1, const void* pNext = nullptr);
+    return layout_binding;
+}
 
-[[nodiscard]] VkCopyDescriptorSet copy_descriptor_set_create(VkDescriptorSet src_set, VkDescriptorSet dst_set, uint32_t src_binding,
-                                                             uint32_t dst_binding, uint32_t src_array_element = 0, uint32_t dst_array_element = 0,
-                                                             uint32_t descriptor_count = 1);
+[[nodiscard]] constexpr VkDescriptorSetLayoutCreateInfo
+descriptor_set_layout_create_info(std::span<const VkDescriptorSetLayoutBinding> layout_bindings, VkDescriptorSetLayoutCreateFlags flags = 0,
+                                  const void* pNext = nullptr) {
+    VkDescriptorSetLayoutCreateInfo descriptor_set_layout_create_info{};
+    descriptor_set_layout_create_info.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    descriptor_set_layout_create_info.bindingCount = layout_bindings.size();
+    descriptor_set_layout_create_info.pBindings    = layout_bindings.data();
+    descriptor_set_layout_create_info.flags        = flags;
+    descriptor_set_layout_create_info.pNext        = pNext;
 
-[[nodiscard]] VkDescriptorImageInfo descriptor_image_info(VkImageView image_view, VkImageLayout image_layout, VkSampler sampler = nullptr);
+    return descriptor_set_layout_create_info;
+}
 
-[[nodiscard]] VkDescriptorBufferInfo descriptor_buffer_info(VkBuffer buffer, uint64_t offset = 0, uint64_t range = VK_WHOLE_SIZE);
+[[nodiscard]] constexpr VkDescriptorPoolSize descriptor_pool_size(VkDescriptorType type, uint32_t descriptor_count) {
+    VkDescriptorPoolSize descriptor_pool_size{};
+    descriptor_pool_size.type            = type;
+    descriptor_pool_size.descriptorCount = descriptor_count;
 
-[[nodiscard]] VkWriteDescriptorSet write_descriptor_set(uint32_t binding, VkDescriptorType type, VkDescriptorSet descriptor_set,
-                                                        const VkDescriptorImageInfo* image_info, const VkDescriptorBufferInfo* buffer_info = nullptr,
-                                                        const VkBufferView* texel_buffer_view = nullptr, uint32_t array_element = 0,
-                                                        uint32_t descriptor_count = 1, const void* pNext = nullptr);
+    return descriptor_pool_size;
+}
+
+[[nodiscard]] constexpr VkDescriptorPoolCreateInfo descriptor_pool_create_info(uint32_t max_sets, std::span<const VkDescriptorPoolSize> pool_sizes,
+                                                                               VkDescriptorPoolCreateFlags flags = 0, const void* pNext = nullptr) {
+    VkDescriptorPoolCreateInfo descriptor_pool_create_info{};
+    descriptor_pool_create_info.sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    descriptor_pool_create_info.maxSets       = max_sets;
+    descriptor_pool_create_info.pPoolSizes    = pool_sizes.data();
+    descriptor_pool_create_info.poolSizeCount = pool_sizes.size();
+    descriptor_pool_create_info.flags         = flags;
+    descriptor_pool_create_info.pNext         = pNext;
+
+    return descriptor_pool_create_info;
+}
+
+[[nodiscard]] constexpr VkDescriptorSetAllocateInfo descriptor_set_allocate_info(const VkDescriptorSetLayout* set_layout,
+                                                                                 VkDescriptorPool descriptor_pool, uint32_t descriptor_set_count = 1,
+                                                                                 const void* pNext = nullptr) {
+    VkDescriptorSetAllocateInfo descriptor_set_allocate_info{};
+    descriptor_set_allocate_info.sType              = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    descriptor_set_allocate_info.pSetLayouts        = set_layout;
+    descriptor_set_allocate_info.descriptorSetCount = descriptor_set_count;
+    descriptor_set_allocate_info.descriptorPool     = descriptor_pool;
+    descriptor_set_allocate_info.pNext              = pNext;
+
+    return descriptor_set_allocate_info;
+}
+
+[[nodiscard]] constexpr VkCopyDescriptorSet copy_descriptor_set_create(VkDescriptorSet src_set, VkDescriptorSet dst_set, uint32_t src_binding,
+                                                                       uint32_t dst_binding, uint32_t src_array_element = 0,
+                                                                       uint32_t dst_array_element = 0, uint32_t descriptor_count = 1) {
+    VkCopyDescriptorSet copy_descriptor_set{};
+    copy_descriptor_set.sType           = VK_STRUCTURE_TYPE_COPY_DESCRIPTOR_SET;
+    copy_descriptor_set.srcSet          = src_set;
+    copy_descriptor_set.srcBinding      = src_binding;
+    copy_descriptor_set.srcArrayElement = src_array_element;
+    copy_descriptor_set.dstSet          = dst_set;
+    copy_descriptor_set.dstBinding      = dst_binding;
+    copy_descriptor_set.dstArrayElement = dst_array_element;
+    copy_descriptor_set.descriptorCount = descriptor_count;
+
+    return copy_descriptor_set;
+}
+
+[[nodiscard]] constexpr VkDescriptorImageInfo descriptor_image_info(VkImageView image_view, VkImageLayout image_layout, VkSampler sampler = nullptr) {
+    VkDescriptorImageInfo image_info{};
+    image_info.imageView   = image_view;
+    image_info.sampler     = sampler;
+    image_info.imageLayout = image_layout;
+
+    return image_info;
+}
+
+[[nodiscard]] constexpr VkDescriptorBufferInfo descriptor_buffer_info(VkBuffer buffer, uint64_t offset = 0, uint64_t range = VK_WHOLE_SIZE) {
+    VkDescriptorBufferInfo buffer_info{};
+    buffer_info.buffer = buffer;
+    buffer_info.offset = offset;
+    buffer_info.range  = range;
+
+    return buffer_info;
+}
+
+[[nodiscard]] constexpr VkWriteDescriptorSet write_descriptor_set(uint32_t binding, VkDescriptorType type, VkDescriptorSet descriptor_set,
+                                                                  const VkDescriptorImageInfo*  image_info,
+                                                                  const VkDescriptorBufferInfo* buffer_info = nullptr,
+                                                                  const VkBufferView* texel_buffer_view = nullptr, uint32_t array_element = 0,
+                                                                  uint32_t descriptor_count = 1, const void* pNext = nullptr) {
+    VkWriteDescriptorSet write_descriptor_set{};
+    write_descriptor_set.sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    write_descriptor_set.dstBinding       = binding;
+    write_descriptor_set.dstSet           = descriptor_set;
+    write_descriptor_set.descriptorCount  = descriptor_count;
+    write_descriptor_set.descriptorType   = type;
+    write_descriptor_set.pImageInfo       = image_info;
+    write_descriptor_set.pBufferInfo      = buffer_info;
+    write_descriptor_set.pTexelBufferView = texel_buffer_view;
+    write_descriptor_set.dstArrayElement  = array_element;
+    write_descriptor_set.pNext            = pNext;
+
+    return write_descriptor_set;
+}
 
 /*
  * CORE EXTENSIONS
  */
 
+// VULKAN 1.1
+
+// offset and stride locate the descriptor infos in the data passed to vkUpdateDescriptorSetWithTemplate
+[[nodiscard]] constexpr VkDescriptorUpdateTemplateEntry descriptor_update_template_entry(uint32_t binding, VkDescriptorType type, size_t offset,
+                                                                                         size_t stride, uint32_t descriptor_count = 1,
+                                                                                         uint32_t array_element = 0) {
+    VkDescriptorUpdateTemplateEntry template_entry{};
+    template_entry.dstBinding      = binding;
+    template_entry.dstArrayElement = array_element;
+    template_entry.descriptorCount = descriptor_count;
+    template_entry.descriptorType  = type;
+    template_entry.offset          = offset;
+    template_entry.stride          = stride;
+
+    return template_entry;
+}
+
+[[nodiscard]] constexpr VkDescriptorUpdateTemplateCreateInfo
+descriptor_update_template_create_info(std::span<const VkDescriptorUpdateTemplateEntry> entries, VkDescriptorSetLayout set_layout,
+                                       VkDescriptorUpdateTemplateCreateFlags flags = 0, const void* pNext = nullptr) {
+    VkDescriptorUpdateTemplateCreateInfo template_create_info{};
+    template_create_info.sType                      = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+    template_create_info.descriptorUpdateEntryCount = entries.size();
+    template_create_info.pDescriptorUpdateEntries   = entries.data();
+    template_create_info.templateType               = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+    template_create_info.descriptorSetLayout        = set_layout;
+    template_create_info.flags                      = flags;
+    template_create_info.pNext                      = pNext;
+
+    return template_create_info;
+}
+
+// VULKAN 1.2
+
+// binding_flags MUST hold an entry for each binding in the layout, in the same order
+[[nodiscard]] constexpr VkDescriptorSetLayoutBindingFlagsCreateInfoEXT
+descriptor_set_layout_binding_flags_create_info(std::span<const VkDescriptorBindingFlags> binding_flags, const void* pNext = nullptr) {
+    VkDescriptorSetLayoutBindingFlagsCreateInfoEXT binding_flags_create_info{};
+    binding_flags_create_info.sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT;
+    binding_flags_create_info.bindingCount  = binding_flags.size();
+    binding_flags_create_info.pBindingFlags = binding_flags.data();
+    binding_flags_create_info.pNext         = pNext;
+
+    return binding_flags_create_info;
+}
+
 // VULKAN 1.3
 
-[[nodiscard]] VkWriteDescriptorSetInlineUniformBlockEXT write_descriptor_set_inline_uniform_block(uint32_t data_size, const void* data,
-                                                                                                  const void* pNext = nullptr);
+[[nodiscard]] constexpr VkWriteDescriptorSetInlineUniformBlockEXT write_descriptor_set_inline_uniform_block(uint32_t data_size, const void* data,
+                                                                                                            const void* pNext = nullptr) {
+    VkWriteDescriptorSetInlineUniformBlockEXT inline_uniform_block_write{};
+    inline_uniform_block_write.sType    = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK_EXT;
+    inline_uniform_block_write.dataSize = data_size;
+    inline_uniform_block_write.pData    = data;
+    inline_uniform_block_write.pNext    = pNext;
+
+    return inline_uniform_block_write;
+}
 
 /*
  * NON-CORE EXTENSIONS
  */
 
-[[nodiscard]] VkWriteDescriptorSetAccelerationStructureKHR
+[[nodiscard]] constexpr VkWriteDescriptorSetAccelerationStructureKHR
 write_descriptor_set_acceleration_structure_khr_batch(std::span<const VkAccelerationStructureKHR> acceleration_structures,
-                                                      const void*                                 pNext = nullptr);
+                                                      const void*                                 pNext = nullptr) {
+    VkWriteDescriptorSetAccelerationStructureKHR accel_struct_write{};
+    accel_struct_write.sType                      = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR;
+    accel_struct_write.accelerationStructureCount = acceleration_structures.size();
+    accel_struct_write.pAccelerationStructures    = acceleration_structures.data();
+    accel_struct_write.pNext                      = pNext;
+
+    return accel_struct_write;
+}
+
+[[nodiscard]] constexpr VkWriteDescriptorSetAccelerationStructureKHR
+write_descriptor_set_acceleration_structure_khr(const VkAccelerationStructureKHR* acceleration_structure, const void* pNext = nullptr) {
+    VkWriteDescriptorSetAccelerationStructureKHR accel_struct_write{};
+    accel_struct_write.sType                      = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR;
+    accel_struct_write.accelerationStructureCount = 1;
+    accel_struct_write.pAccelerationStructures    = acceleration_structure;
+    accel_struct_write.pNext                      = pNext;
+
+    return accel_struct_write;
+}
+
+[[nodiscard]] constexpr VkDescriptorAddressInfoEXT descriptor_address_info_ext(VkDeviceAddress address, uint64_t range,
+                                                                               VkFormat format = VK_FORMAT_UNDEFINED, void* pNext = nullptr) {
+    VkDescriptorAddressInfoEXT address_info{};
+    address_info.sType   = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT;
+    address_info.address = address;
+    address_info.range   = range;
+    address_info.format  = format;
+    address_info.pNext   = pNext;
+
+    return address_info;
+}
+
+// data holds the pointer member matching type, e.g. data.pStorageBuffer for VK_DESCRIPTOR_TYPE_STORAGE_BUFFER
+[[nodiscard]] constexpr VkDescriptorGetInfoEXT descriptor_get_info_ext(VkDescriptorType type, VkDescriptorDataEXT data, const void* pNext = nullptr) {
+    VkDescriptorGetInfoEXT get_info{};
+    get_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+    get_info.type  = type;
+    get_info.data  = data;
+    get_info.pNext = pNext;
+
+    return get_info;
+}
+
+[[nodiscard]] constexpr VkDescriptorBufferBindingInfoEXT descriptor_buffer_binding_info_ext(VkDeviceAddress address, VkBufferUsageFlags usage,
+                                                                                           void* pNext = nullptr) {
+    VkDescriptorBufferBindingInfoEXT binding_info{};
+    binding_info.sType   = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT;
+    binding_info.address = address;
+    binding_info.usage   = usage;
+    binding_info.pNext   = pNext;
 
-[[nodiscard]] VkWriteDescriptorSetAccelerationStructureKHR
-write_descriptor_set_acceleration_structure_khr(const VkAccelerationStructureKHR* acceleration_structure, const void* pNext = nullptr);
+    return binding_info;
+}
 
 } // namespace vk_lib
\ No newline at end of file
@@ -7,30 +7,96 @@
 
 namespace vk_lib {
 
-[[nodiscard]] VkSemaphoreCreateInfo semaphore_create_info(const void* pNext = nullptr);
+[[nodiscard]] constexpr VkSemaphoreCreateInfo semaphore_create_info(const void* pNext = nullptr) {
+    VkSemaphoreCreateInfo semaphore_create_info{};
+    semaphore_create_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+    semaphore_create_info.flags = 0;
+    semaphore_create_info.pNext = pNext;
 
-[[nodiscard]] VkFenceCreateInfo fence_create_info(VkFenceCreateFlags flags = 0, const void* pNext = nullptr);
+    return semaphore_create_info;
+}
 
-[[nodiscard]] VkSemaphoreSubmitInfoKHR semaphore_submit_info(VkSemaphore semaphore, VkPipelineStageFlags2KHR stage_mask, uint64_t timeline_value = 0,
-                                                             uint32_t device_index = 0);
+[[nodiscard]] constexpr VkFenceCreateInfo fence_create_info(VkFenceCreateFlags flags = 0, const void* pNext = nullptr) {
+    VkFenceCreateInfo fence_create_info{};
+    fence_create_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+    fence_create_info.flags = flags;
+    fence_create_info.pNext = pNext;
+
+    return fence_create_info;
+}
+
+[[nodiscard]] constexpr VkSemaphoreSubmitInfoKHR semaphore_submit_info(VkSemaphore semaphore, VkPipelineStageFlags2KHR stage_mask,
+                                                                       uint64_t timeline_value = 0, uint32_t device_index = 0) {
+    VkSemaphoreSubmitInfoKHR semaphore_submit_info{};
+    semaphore_submit_info.sType       = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO_KHR;
+    semaphore_submit_info.semaphore   = semaphore;
+    semaphore_submit_info.stageMask   = stage_mask;
+    semaphore_submit_info.deviceIndex = device_index;
+    semaphore_submit_info.value       = timeline_value;
+    semaphore_submit_info.pNext       = nullptr;
+
+    return semaphore_submit_info;
+}
 
 // subresource_range MUST NOT be null
-[[nodiscard]] VkImageMemoryBarrier image_memory_barrier(VkImage image, const VkImageSubresourceRange* subresource_range, VkImageLayout old_layout,
-                                                        VkImageLayout new_layout, VkAccessFlags src_access_mask = VK_ACCESS_MEMORY_WRITE_BIT,
-                                                        VkAccessFlags dst_access_mask        = VK_ACCESS_MEMORY_WRITE_BIT | VK_ACCESS_MEMORY_READ_BIT,
-                                                        uint32_t      src_queue_family_index = VK_QUEUE_FAMILY_IGNORED,
-                                                        uint32_t dst_queue_family_index = VK_QUEUE_FAMILY_IGNORED, const void* pNext = nullptr);
+[[nodiscard]] constexpr VkImageMemoryBarrier
+image_memory_barrier(VkImage image, const VkImageSubresourceRange* subresource_range, VkImageLayout old_layout, VkImageLayout new_layout,
+                     VkAccessFlags src_access_mask = VK_ACCESS_MEMORY_WRITE_BIT,
+                     VkAccessFlags dst_access_mask = VK_ACCESS_MEMORY_WRITE_BIT | VK_ACCESS_MEMORY_READ_BIT,
+                     uint32_t src_queue_family_index = VK_QUEUE_FAMILY_IGNORED, uint32_t dst_queue_family_index = VK_QUEUE_FAMILY_IGNORED,
+                     const void* pNext = nullptr) {
+    VkImageMemoryBarrier image_mem_barrier{};
+    image_mem_barrier.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    image_mem_barrier.srcAccessMask       = src_access_mask;
+    image_mem_barrier.dstAccessMask       = dst_access_mask;
+    image_mem_barrier.image               = image;
+    image_mem_barrier.oldLayout           = old_layout;
+    image_mem_barrier.newLayout           = new_layout;
+    image_mem_barrier.srcQueueFamilyIndex = src_queue_family_index;
+    image_mem_barrier.dstQueueFamilyIndex = dst_queue_family_index;
+    image_mem_barrier.subresourceRange    = *subresource_range;
+    image_mem_barrier.pNext               = pNext;
+
+    return image_mem_barrier;
+}
+
+[[nodiscard]] constexpr VkBufferMemoryBarrier
+buffer_memory_barrier(VkBuffer buffer, VkAccessFlags src_access_mask = VK_ACCESS_MEMORY_WRITE_BIT,
+                      VkAccessFlags dst_access_mask = VK_ACCESS_MEMORY_WRITE_BIT | VK_ACCESS_MEMORY_READ_BIT, uint64_t offset = 0,
+                      uint64_t size = VK_WHOLE_SIZE, uint32_t src_queue_family_index = VK_QUEUE_FAMILY_IGNORED,
+                      uint32_t dst_queue_family_index = VK_QUEUE_FAMILY_IGNORED, const void* pNext = nullptr) {
+    VkBufferMemoryBarrier buffer_mem_barrier{};
+    buffer_mem_barrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    buffer_mem_barrier.srcAccessMask       = src_access_mask;
+    buffer_mem_barrier.dstAccessMask       = dst_access_mask;
+    buffer_mem_barrier.srcQueueFamilyIndex = src_queue_family_index;
+    buffer_mem_barrier.dstQueueFamilyIndex = dst_queue_family_index;
+    buffer_mem_barrier.buffer              = buffer;
+    buffer_mem_barrier.offset              = offset;
+    buffer_mem_barrier.size                = size;
+    buffer_mem_barrier.pNext               = pNext;
+
+    return buffer_mem_barrier;
+}
 
-[[nodiscard]] VkBufferMemoryBarrier buffer_memory_barrier(VkBuffer buffer, VkAccessFlags src_access_mask = VK_ACCESS_MEMORY_WRITE_BIT,
-                                                          VkAccessFlags dst_access_mask = VK_ACCESS_MEMORY_WRITE_BIT | VK_ACCESS_MEMORY_READ_BIT,
-                                                          uint64_t offset = 0, uint64_t size = VK_WHOLE_SIZE,
-                                                          uint32_t src_queue_family_index = VK_QUEUE_FAMILY_IGNORED,
-                                                          uint32_t dst_queue_family_index = VK_QUEUE_FAMILY_IGNORED, const void* pNext = nullptr);
+[[nodiscard]] constexpr VkMemoryBarrier memory_barrier(VkAccessFlags src_access_mask = VK_ACCESS_MEMORY_WRITE_BIT,
+                                                       VkAccessFlags dst_access_mask = VK_ACCESS_MEMORY_WRITE_BIT | VK_ACCESS_MEMORY_READ_BIT) {
+    VkMemoryBarrier mem_barrier{};
+    mem_barrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    mem_barrier.srcAccessMask = src_access_mask;
+    mem_barrier.dstAccessMask = dst_access_mask;
 
-[[nodiscard]] VkMemoryBarrier memory_barrier(VkAccessFlags src_access_mask = VK_ACCESS_MEMORY_WRITE_BIT,
-                                             VkAccessFlags dst_access_mask = VK_ACCESS_MEMORY_WRITE_BIT | VK_ACCESS_MEMORY_READ_BIT);
+    return mem_barrier;
+}
 
-[[nodiscard]] VkEventCreateInfo event_create_info(VkEventCreateFlags flags = 0, const void* pNext = nullptr);
+[[nodiscard]] constexpr VkEventCreateInfo event_create_info(VkEventCreateFlags flags = 0, const void* pNext = nullptr) {
+    VkEventCreateInfo event_create_info{};
+    event_create_info.sType = VK_STRUCTURE_TYPE_EVENT_CREATE_INFO;
+    event_create_info.flags = flags;
+    event_create_info.pNext = pNext;
+
+    return event_create_info;
+}
 
 /*
  * CORE EXTENSIONS
@@ -38,40 +104,168 @@ namespace vk_lib {
 
 // VULKAN 1.2
 
-[[nodiscard]] VkSemaphoreTypeCreateInfoKHR semaphore_type_create_info(VkSemaphoreType type, uint64_t initial_timeline_value = 0,
-                                                                      const void* pNext = nullptr);
+[[nodiscard]] constexpr VkSemaphoreTypeCreateInfoKHR semaphore_type_create_info(VkSemaphoreType type, uint64_t initial_timeline_value = 0,
+                                                                                const void* pNext = nullptr) {
+    VkSemaphoreTypeCreateInfoKHR semaphore_type_create_info{};
+    semaphore_type_create_info.sType         = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+    semaphore_type_create_info.semaphoreType = type;
+    semaphore_type_create_info.initialValue  = initial_timeline_value;
+    semaphore_type_create_info.pNext         = pNext;
+
+    return semaphore_type_create_info;
+}
+
+// values MUST have as many elements as semaphores
+[[nodiscard]] constexpr VkSemaphoreWaitInfoKHR semaphore_wait_info(std::span<const VkSemaphore> semaphores, std::span<const uint64_t> values,
+                                                                   VkSemaphoreWaitFlags flags = 0, const void* pNext = nullptr) {
+    VkSemaphoreWaitInfoKHR semaphore_wait_info{};
+    semaphore_wait_info.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+    semaphore_wait_info.flags          = flags;
+    semaphore_wait_info.semaphoreCount = semaphores.size();
+    semaphore_wait_info.pSemaphores    = semaphores.data();
+    semaphore_wait_info.pValues        = values.data();
+    semaphore_wait_info.pNext          = pNext;
+
+    return semaphore_wait_info;
+}
 
 // VULKAN 1.3
 
-[[nodiscard]] VkImageMemoryBarrier2KHR
+[[nodiscard]] constexpr VkImageMemoryBarrier2KHR
 image_memory_barrier_2(VkImage image, VkImageSubresourceRange subresource_range, VkImageLayout old_layout, VkImageLayout new_layout,
                        VkPipelineStageFlags2 src_stage_mask  = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
                        VkPipelineStageFlags2 dst_stage_mask  = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
                        VkAccessFlags2        src_access_mask = VK_ACCESS_2_MEMORY_WRITE_BIT_KHR,
                        VkAccessFlags2        dst_access_mask = VK_ACCESS_2_MEMORY_WRITE_BIT_KHR | VK_ACCESS_2_SHADER_READ_BIT_KHR,
                        uint32_t src_queue_family_index = VK_QUEUE_FAMILY_IGNORED, uint32_t dst_queue_family_index = VK_QUEUE_FAMILY_IGNORED,
-                       const void* pNext = nullptr);
+                       const void* pNext = nullptr) {
+    VkImageMemoryBarrier2KHR image_mem_barrier_2{};
+    image_mem_barrier_2.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR;
+    image_mem_barrier_2.srcStageMask        = src_stage_mask;
+    image_mem_barrier_2.srcAccessMask       = src_access_mask;
+    image_mem_barrier_2.dstStageMask        = dst_stage_mask;
+    image_mem_barrier_2.dstAccessMask       = dst_access_mask;
+    image_mem_barrier_2.image               = image;
+    image_mem_barrier_2.oldLayout           = old_layout;
+    image_mem_barrier_2.newLayout           = new_layout;
+    image_mem_barrier_2.srcQueueFamilyIndex = src_queue_family_index;
+    image_mem_barrier_2.dstQueueFamilyIndex = dst_queue_family_index;
+    image_mem_barrier_2.subresourceRange    = subresource_range;
+    image_mem_barrier_2.pNext               = pNext;
+
+    return image_mem_barrier_2;
+}
 
-[[nodiscard]] VkBufferMemoryBarrier2KHR
+[[nodiscard]] constexpr VkBufferMemoryBarrier2KHR
 buffer_memory_barrier_2(VkBuffer buffer, VkPipelineStageFlags2 src_stage_mask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
                         VkPipelineStageFlags2 dst_stage_mask  = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
                         VkAccessFlags2KHR     src_access_mask = VK_ACCESS_2_MEMORY_WRITE_BIT_KHR,
                         VkAccessFlags2KHR     dst_access_mask = VK_ACCESS_2_MEMORY_WRITE_BIT_KHR | VK_ACCESS_2_SHADER_READ_BIT_KHR,
 
                         uint64_t offset = 0, uint64_t size = VK_WHOLE_SIZE, uint32_t src_queue_family_index = VK_QUEUE_FAMILY_IGNORED,
-                        uint32_t dst_queue_family_index = VK_QUEUE_FAMILY_IGNORED, const void* pNext = nullptr);
+                        uint32_t dst_queue_family_index = VK_QUEUE_FAMILY_IGNORED, const void* pNext = nullptr) {
+    VkBufferMemoryBarrier2KHR buffer_memory_barrier_2{};
+    buffer_memory_barrier_2.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2_KHR;
+    buffer_memory_barrier_2.srcStageMask        = src_stage_mask;
+    buffer_memory_barrier_2.srcAccessMask       = src_access_mask;
+    buffer_memory_barrier_2.dstStageMask        = dst_stage_mask;
+    buffer_memory_barrier_2.dstAccessMask       = dst_access_mask;
+    buffer_memory_barrier_2.srcQueueFamilyIndex = src_queue_family_index;
+    buffer_memory_barrier_2.dstQueueFamilyIndex = dst_queue_family_index;
+    buffer_memory_barrier_2.buffer              = buffer;
+    buffer_memory_barrier_2.offset              = offset;
+    buffer_memory_barrier_2.size                = size;
+    buffer_memory_barrier_2.pNext               = pNext;
+
+    return buffer_memory_barrier_2;
+}
+
+[[nodiscard]] constexpr VkMemoryBarrier2KHR global_memory_barrier_2(VkPipelineStageFlags2 src_stage_mask  = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+                                                                    VkPipelineStageFlags2 dst_stage_mask  = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+                                                                    VkAccessFlags2KHR     src_access_mask = VK_ACCESS_2_MEMORY_WRITE_BIT_KHR,
+                                                                    VkAccessFlags2KHR     dst_access_mask = VK_ACCESS_2_MEMORY_WRITE_BIT_KHR |
+                                                                                                        VK_ACCESS_2_SHADER_READ_BIT_KHR) {
+    VkMemoryBarrier2KHR memory_barrier{};
+    memory_barrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2_KHR;
+    memory_barrier.srcStageMask  = src_stage_mask;
+    memory_barrier.srcAccessMask = src_access_mask;
+    memory_barrier.dstStageMask  = dst_stage_mask;
+    memory_barrier.dstAccessMask = dst_access_mask;
+
+    return memory_barrier;
+}
+
+[[nodiscard]] constexpr VkDependencyInfoKHR dependency_info_batch(std::span<const VkImageMemoryBarrier2KHR> image_barriers,
+                                                                  std::span<const VkBufferMemoryBarrier2KHR> buffer_barriers,
+                                                                  std::span<const VkMemoryBarrier2KHR>       memory_barriers,
+                                                                  VkDependencyFlags                          dependency_flags = 0) {
+    VkDependencyInfoKHR dependency_info{};
+    dependency_info.sType                    = VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR;
+    dependency_info.pNext                    = nullptr;
+    dependency_info.pImageMemoryBarriers     = image_barriers.data();
+    dependency_info.imageMemoryBarrierCount  = image_barriers.size();
+    dependency_info.pBufferMemoryBarriers    = buffer_barriers.data();
+    dependency_info.bufferMemoryBarrierCount = buffer_barriers.size();
+    dependency_info.pMemoryBarriers          = memory_barriers.data();
+    dependency_info.memoryBarrierCount       = memory_barriers.size();
+    dependency_info.dependencyFlags          = dependency_flags;
+
+    return dependency_info;
+}
+
+[[nodiscard]] constexpr VkDependencyInfoKHR dependency_info(const VkImageMemoryBarrier2KHR* image_barrier,
+                                                            const VkBufferMemoryBarrier2KHR* buffer_barrier,
+                                                            const VkMemoryBarrier2KHR* memory_barrier, VkDependencyFlags dependency_flags = 0) {
+    VkDependencyInfoKHR dependency_info{};
+    dependency_info.sType                    = VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR;
+    dependency_info.pNext                    = nullptr;
+    dependency_info.pImageMemoryBarriers     = image_barrier;
+    dependency_info.imageMemoryBarrierCount  = image_barrier == nullptr ? 0 : 1;
+    dependency_info.pBufferMemoryBarriers    = buffer_barrier;
+    dependency_info.bufferMemoryBarrierCount = buffer_barrier == nullptr ? 0 : 1;
+    dependency_info.pMemoryBarriers          = memory_barrier;
+    dependency_info.memoryBarrierCount       = memory_barrier == nullptr ? 0 : 1;
+    dependency_info.dependencyFlags          = dependency_flags;
+
+    return dependency_info;
+}
+
+/*
+ * FRAMES IN FLIGHT
+ *
+ * Tracks when the GPU finished each frame with a single timeline semaphore instead of a fence per frame. Frame N's last
+ * submission signals the semaphore with the value N + 1, so waiting for any earlier frame is a wait for a value and
+ * nothing ever needs to be reset:
+ *
+ *   frame_context_init()                   once, creates the timeline semaphore
+ *   frame_context_begin()                  waits until the frame that last used the returned frame index completed
+ *   frame_context_signal_info()            signalled by the frame's last submission
+ *   frame_context_wait_for_previous()      optionally, to keep fewer frames queued than there are frame indices
+ *
+ * Per-frame resources are indexed with the frame index, they are free to be reused once frame_context_begin() returned.
+ */
+
+struct FrameContext {
+    VkSemaphore timeline_semaphore{};
+    uint32_t    frame_count{};
+    // frames begun so far, which is also the value the current frame signals
+    uint64_t frame_number{};
+    // highest value the semaphore is known to have reached, saves waiting on frames that already completed
+    uint64_t completed_value{};
+};
+
+// the semaphore is owned by the caller and destroyed after the device is idle
+[[nodiscard]] VkResult frame_context_init(FrameContext* frame_context, PFN_vkCreateSemaphore create_semaphore, VkDevice device, uint32_t frame_count);
 
-[[nodiscard]] VkMemoryBarrier2KHR global_memory_barrier_2(VkPipelineStageFlags2 src_stage_mask  = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
-                                                          VkPipelineStageFlags2 dst_stage_mask  = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
-                                                          VkAccessFlags2KHR     src_access_mask = VK_ACCESS_2_MEMORY_WRITE_BIT_KHR,
-                                                          VkAccessFlags2KHR     dst_access_mask = VK_ACCESS_2_MEMORY_WRITE_BIT_KHR |
-                                                                                              VK_ACCESS_2_SHADER_READ_BIT_KHR);
+// returns VK_TIMEOUT if the frame that last used frame_index did not complete in time, the frame is not begun then
+[[nodiscard]] VkResult frame_context_begin(FrameContext* frame_context, PFN_vkWaitSemaphores wait_semaphores, VkDevice device, uint32_t* frame_index,
+                                           uint64_t timeout = UINT64_MAX);
 
-[[nodiscard]] VkDependencyInfoKHR dependency_info_batch(std::span<const VkImageMemoryBarrier2KHR>  image_barriers,
-                                                        std::span<const VkBufferMemoryBarrier2KHR> buffer_barriers,
-                                                        std::span<const VkMemoryBarrier2KHR> memory_barriers, VkDependencyFlags dependency_flags = 0);
+[[nodiscard]] VkSemaphoreSubmitInfoKHR frame_context_signal_info(const FrameContext*      frame_context,
+                                                                 VkPipelineStageFlags2KHR stage_mask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT);
 
-[[nodiscard]] VkDependencyInfoKHR dependency_info(const VkImageMemoryBarrier2KHR* image_barrier, const VkBufferMemoryBarrier2KHR* buffer_barrier,
-                                                  const VkMemoryBarrier2KHR* memory_barrier, VkDependencyFlags dependency_flags = 0);
+// waits for the frame begun frames_ago frames before the current one, e.g. 1 lets only the current frame be queued
+[[nodiscard]] VkResult frame_context_wait_for_previous(FrameContext* frame_context, PFN_vkWaitSemaphores wait_semaphores, VkDevice device,
+                                                       uint32_t frames_ago, uint64_t timeout = UINT64_MAX);
 
 } // namespace vk_lib
\ No newline at end of file
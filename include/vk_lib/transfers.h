@@ -0,0 +1,133 @@
+/*
+ * Utilities regarding staging memory and uploads through transfer commands
+ */
+
+#pragma once
+#include <vk_lib/common.h>
+
+namespace vk_lib {
+
+/*
+ * STAGING RING
+ *
+ * Hands out sub-ranges of one persistently mapped, host visible buffer and batches the copies out of it.
+ * Space is reclaimed once the frame that used it retires: tag each frame with staging_ring_end_frame() using a
+ * monotonically increasing value (a frame number waited on with a fence, or a timeline semaphore value) and call
+ * staging_ring_retire() with the last completed value. Memory that is not HOST_COHERENT must be flushed with
+ * mapped_memory_range() before submitting.
+ */
+
+struct StagingAllocation {
+    void*    data{};
+    uint64_t offset{};
+    uint64_t size{};
+};
+
+struct StagingBufferCopies {
+    VkBuffer                  dst_buffer{};
+    std::vector<VkBufferCopy> regions{};
+};
+
+struct StagingImageCopies {
+    VkImage                        dst_image{};
+    VkImageLayout                  dst_image_layout{};
+    std::vector<VkBufferImageCopy> regions{};
+};
+
+struct StagingRetirement {
+    uint64_t retire_value{};
+    uint64_t head{};
+};
+
+struct StagingRing {
+    VkBuffer buffer{};
+    uint8_t* mapped_data{};
+    uint64_t size{};
+    // head and tail only ever grow, the buffer offset is the position modulo size
+    uint64_t                         head{};
+    uint64_t                         tail{};
+    std::deque<StagingRetirement>    in_flight{};
+    std::vector<StagingBufferCopies> buffer_copies{};
+    std::vector<StagingImageCopies>  image_copies{};
+};
+
+// mapped_data MUST point at the start of buffer's persistent mapping
+[[nodiscard]] StagingRing staging_ring(VkBuffer buffer, void* mapped_data, uint64_t size);
+
+// returns VK_NOT_READY when the ring is full until earlier frames retire
+[[nodiscard]] VkResult staging_ring_allocate(StagingRing* ring, uint64_t size, uint64_t alignment, StagingAllocation* allocation);
+
+// copies data into the ring and records a VkBufferCopy into dst_buffer, merging it with the previous region when contiguous
+[[nodiscard]] VkResult staging_ring_upload_buffer(StagingRing* ring, VkBuffer dst_buffer, const void* data, uint64_t size, uint64_t dst_offset = 0,
+                                                  uint64_t alignment = 4);
+
+// copies tightly packed texel data into the ring and records a VkBufferImageCopy into dst_image
+// alignment MUST be a multiple of the format's texel block size and of 4
+[[nodiscard]] VkResult staging_ring_upload_image(StagingRing* ring, VkImage dst_image, const void* data, uint64_t size,
+                                                 VkImageSubresourceLayers image_subresource, VkExtent3D image_extent,
+                                                 VkOffset3D image_offset = {0, 0, 0}, uint64_t alignment = 16,
+                                                 VkImageLayout dst_image_layout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+
+// call once the batched copies have been recorded with vkCmdCopyBuffer / vkCmdCopyBufferToImage
+void staging_ring_clear_copies(StagingRing* ring);
+
+// everything allocated since the previous call is reclaimed once retire_value is passed to staging_ring_retire()
+void staging_ring_end_frame(StagingRing* ring, uint64_t retire_value);
+
+void staging_ring_retire(StagingRing* ring, uint64_t completed_value);
+
+/*
+ * UPLOAD QUEUE
+ *
+ * Streams the copies batched in a StagingRing on a dedicated transfer queue so they overlap with rendering. Every
+ * batch signals the next value of a timeline semaphore (created with semaphore_type_create_info()) and the consuming
+ * queue waits on exactly that value. When the two queue families differ, the generated barriers also transfer queue
+ * family ownership of the uploaded resources. Per batch:
+ *
+ *   upload_queue_build_barriers()                      once every upload of the batch is staged
+ *   upload_queue_pre_copy_dependency_info()            recorded on the transfer command buffer, then the copies
+ *   upload_queue_release_dependency_info()             recorded on the transfer command buffer after the copies
+ *   upload_queue_submit_info()                         submitted on the transfer queue
+ *   upload_queue_acquire_dependency_info()             recorded on the consuming queue before the resources are used
+ *   upload_queue_wait_semaphore_submit_info()          added to the consuming queue's submission
+ */
+
+struct UploadQueue {
+    StagingRing                            staging_ring{};
+    VkSemaphore                            timeline_semaphore{};
+    uint32_t                               transfer_queue_family{};
+    uint32_t                               dst_queue_family{};
+    // last value signaled by a submitted batch
+    uint64_t                               timeline_value{};
+    std::vector<VkImageMemoryBarrier2KHR>  pre_copy_image_barriers{};
+    std::vector<VkBufferMemoryBarrier2KHR> release_buffer_barriers{};
+    std::vector<VkImageMemoryBarrier2KHR>  release_image_barriers{};
+    std::vector<VkBufferMemoryBarrier2KHR> acquire_buffer_barriers{};
+    std::vector<VkImageMemoryBarrier2KHR>  acquire_image_barriers{};
+    VkCommandBufferSubmitInfoKHR           command_buffer_submit_info{};
+    VkSemaphoreSubmitInfoKHR               signal_semaphore_submit_info{};
+};
+
+[[nodiscard]] UploadQueue upload_queue(StagingRing staging_ring, VkSemaphore timeline_semaphore, uint32_t transfer_queue_family,
+                                       uint32_t dst_queue_family, uint64_t initial_timeline_value = 0);
+
+// uploaded images are assumed to hold no prior contents and end up in dst_image_layout
+void upload_queue_build_barriers(UploadQueue* upload_queue, VkPipelineStageFlags2 dst_stage_mask, VkAccessFlags2 dst_access_mask,
+                                 VkImageLayout dst_image_layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+[[nodiscard]] VkDependencyInfoKHR upload_queue_pre_copy_dependency_info(const UploadQueue* upload_queue);
+
+[[nodiscard]] VkDependencyInfoKHR upload_queue_release_dependency_info(const UploadQueue* upload_queue);
+
+// stays valid until the next upload_queue_build_barriers()
+[[nodiscard]] VkDependencyInfoKHR upload_queue_acquire_dependency_info(const UploadQueue* upload_queue);
+
+// advances the timeline value, tags the batch's staging space with it and clears the recorded copies
+// the returned structure points into upload_queue and is valid until the next call
+[[nodiscard]] VkSubmitInfo2KHR upload_queue_submit_info(UploadQueue* upload_queue, VkCommandBuffer command_buffer);
+
+// waits on the value signaled by the most recently submitted batch
+[[nodiscard]] VkSemaphoreSubmitInfoKHR upload_queue_wait_semaphore_submit_info(const UploadQueue* upload_queue,
+                                                                               VkPipelineStageFlags2 stage_mask);
+
+} // namespace vk_lib
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include <vk_lib/barriers.h>
+#include <vk_lib/counters.h>
+#include <vk_lib/synchronization.h>
+
+namespace vk_lib {
+
+namespace {
+
+constexpr VkAccessFlags2 read_access_mask =
+    VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_2_INDEX_READ_BIT | VK_ACCESS_2_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_2_UNIFORM_READ_BIT |
+    VK_ACCESS_2_INPUT_ATTACHMENT_READ_BIT | VK_ACCESS_2_SHADER_READ_BIT | VK_ACCESS_2_COLOR_ATTACHMENT_READ_BIT |
+    VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_2_TRANSFER_READ_BIT | VK_ACCESS_2_HOST_READ_BIT | VK_ACCESS_2_MEMORY_READ_BIT |
+    VK_ACCESS_2_SHADER_SAMPLED_READ_BIT | VK_ACCESS_2_SHADER_STORAGE_READ_BIT;
+
+// barriers without stages are no-ops, as are barriers between reads only
+// NONE accesses are kept, they make execution only dependencies such as a write after read
+bool orders_nothing(VkPipelineStageFlags2 src_stage_mask, VkPipelineStageFlags2 dst_stage_mask, VkAccessFlags2 src_access_mask,
+                    VkAccessFlags2 dst_access_mask) {
+    if (src_stage_mask == 0 && dst_stage_mask == 0) {
+        return true;
+    }
+    // any access that is not a known read is treated as a write
+    return src_access_mask != 0 && dst_access_mask != 0 && ((src_access_mask | dst_access_mask) & ~read_access_mask) == 0;
+}
+
+bool transfers_ownership(uint32_t src_queue_family_index, uint32_t dst_queue_family_index) {
+    return src_queue_family_index != dst_queue_family_index;
+}
+
+bool same_subresource_range(const VkImageSubresourceRange* a, const VkImageSubresourceRange* b) {
+    return a->aspectMask == b->aspectMask && a->baseMipLevel == b->baseMipLevel && a->levelCount == b->levelCount &&
+           a->baseArrayLayer == b->baseArrayLayer && a->layerCount == b->layerCount;
+}
+
+template <typename Barrier> void merge_scopes(Barrier* pending, const Barrier* barrier) {
+    pending->srcStageMask |= barrier->srcStageMask;
+    pending->srcAccessMask |= barrier->srcAccessMask;
+    pending->dstStageMask |= barrier->dstStageMask;
+    pending->dstAccessMask |= barrier->dstAccessMask;
+}
+
+} // namespace
+
+void barrier_batch_add_image(BarrierBatch* batch, const VkImageMemoryBarrier2KHR* image_barrier) {
+    const bool ownership_transfer = transfers_ownership(image_barrier->srcQueueFamilyIndex, image_barrier->dstQueueFamilyIndex);
+    if (image_barrier->oldLayout == image_barrier->newLayout && !ownership_transfer &&
+        orders_nothing(image_barrier->srcStageMask, image_barrier->dstStageMask, image_barrier->srcAccessMask, image_barrier->dstAccessMask)) {
+        return;
+    }
+    if (!ownership_transfer) {
+        for (VkImageMemoryBarrier2KHR& pending : batch->image_barriers) {
+            // layouts that don't chain can't be expressed by one transition
+            if (pending.image != image_barrier->image || transfers_ownership(pending.srcQueueFamilyIndex, pending.dstQueueFamilyIndex) ||
+                !same_subresource_range(&pending.subresourceRange, &image_barrier->subresourceRange) ||
+                pending.newLayout != image_barrier->oldLayout) {
+                continue;
+            }
+            merge_scopes(&pending, image_barrier);
+            pending.newLayout = image_barrier->newLayout;
+            return;
+        }
+    }
+    VK_LIB_COUNT(Barriers, 1);
+    batch->image_barriers.push_back(*image_barrier);
+}
+
+void barrier_batch_add_buffer(BarrierBatch* batch, const VkBufferMemoryBarrier2KHR* buffer_barrier) {
+    const bool ownership_transfer = transfers_ownership(buffer_barrier->srcQueueFamilyIndex, buffer_barrier->dstQueueFamilyIndex);
+    if (!ownership_transfer &&
+        orders_nothing(buffer_barrier->srcStageMask, buffer_barrier->dstStageMask, buffer_barrier->srcAccessMask, buffer_barrier->dstAccessMask)) {
+        return;
+    }
+    if (!ownership_transfer) {
+        for (VkBufferMemoryBarrier2KHR& pending : batch->buffer_barriers) {
+            if (pending.buffer != buffer_barrier->buffer || transfers_ownership(pending.srcQueueFamilyIndex, pending.dstQueueFamilyIndex) ||
+                pending.offset != buffer_barrier->offset || pending.size != buffer_barrier->size) {
+                continue;
+            }
+            merge_scopes(&pending, buffer_barrier);
+            return;
+        }
+    }
+    VK_LIB_COUNT(Barriers, 1);
+    batch->buffer_barriers.push_back(*buffer_barrier);
+}
+
+void barrier_batch_add_memory(BarrierBatch* batch, const VkMemoryBarrier2KHR* memory_barrier) {
+    if (orders_nothing(memory_barrier->srcStageMask, memory_barrier->dstStageMask, memory_barrier->srcAccessMask, memory_barrier->dstAccessMask)) {
+        return;
+    }
+    if (batch->memory_barriers.empty()) {
+        VK_LIB_COUNT(Barriers, 1);
+        batch->memory_barriers.push_back(*memory_barrier);
+        return;
+    }
+    merge_scopes(&batch->memory_barriers.front(), memory_barrier);
+}
+
+bool barrier_batch_empty(const BarrierBatch* batch) {
+    return batch->image_barriers.empty() && batch->buffer_barriers.empty() && batch->memory_barriers.empty();
+}
+
+VkDependencyInfoKHR barrier_batch_dependency_info(const BarrierBatch* batch, VkDependencyFlags dependency_flags) {
+    return dependency_info_batch(batch->image_barriers, batch->buffer_barriers, batch->memory_barriers, dependency_flags);
+}
+
+void barrier_batch_clear(BarrierBatch* batch) {
+    batch->image_barriers.clear();
+    batch->buffer_barriers.clear();
+    batch->memory_barriers.clear();
+}
+
+} // namespace vk_lib
\ No newline at end of file
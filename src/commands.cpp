@@ -1,114 +1,91 @@
+#include <algorithm>
 #include <vk_lib/commands.h>
+#include <vk_lib/counters.h>
 
 namespace vk_lib {
 
-VkCommandPoolCreateInfo command_pool_create_info(uint32_t queue_family_index, VkCommandPoolCreateFlags flags) {
-    VkCommandPoolCreateInfo command_pool_create_info{};
-    command_pool_create_info.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-    command_pool_create_info.queueFamilyIndex = queue_family_index;
-    command_pool_create_info.flags            = flags;
-
-    return command_pool_create_info;
-}
-
-VkCommandBufferAllocateInfo command_buffer_allocate_info(VkCommandPool command_pool, VkCommandBufferLevel level, uint32_t command_buffer_count) {
-    VkCommandBufferAllocateInfo command_buffer_allocate_info{};
-    command_buffer_allocate_info.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-    command_buffer_allocate_info.level              = level;
-    command_buffer_allocate_info.commandBufferCount = command_buffer_count;
-    command_buffer_allocate_info.commandPool        = command_pool;
-
-    return command_buffer_allocate_info;
-}
-
-VkCommandBufferBeginInfo command_buffer_begin_info(VkCommandBufferUsageFlags flags, const VkCommandBufferInheritanceInfo* inheritance_info,
-                                                   const void* pNext) {
-    VkCommandBufferBeginInfo command_buffer_begin_info{};
-    command_buffer_begin_info.sType            = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-    command_buffer_begin_info.pNext            = pNext;
-    command_buffer_begin_info.flags            = flags;
-    command_buffer_begin_info.pInheritanceInfo = inheritance_info;
-
-    return command_buffer_begin_info;
+VkResult command_allocator_init(CommandAllocator* allocator, PFN_vkCreateCommandPool create_command_pool, VkDevice device,
+                                std::span<const uint32_t> queue_family_indices, uint32_t thread_count, uint32_t frame_count) {
+    allocator->queue_family_indices.assign(queue_family_indices.begin(), queue_family_indices.end());
+    allocator->thread_count = thread_count;
+    allocator->frame_count  = frame_count;
+    allocator->slots        = std::vector<CommandPoolSlot>(frame_count * queue_family_indices.size() * thread_count);
+    allocator->registered_threads.store(0, std::memory_order_relaxed);
+
+    for (size_t i = 0; i < allocator->slots.size(); i++) {
+        const uint32_t          queue_family_index = queue_family_indices[i / thread_count % queue_family_indices.size()];
+        VkCommandPoolCreateInfo create_info        = command_pool_create_info(queue_family_index, VK_COMMAND_POOL_CREATE_TRANSIENT_BIT);
+        VK_LIB_COUNT(ObjectCreations, 1);
+        VkResult result = create_command_pool(device, &create_info, nullptr, &allocator->slots[i].pool);
+        if (result != VK_SUCCESS) {
+            return result;
+        }
+    }
+    return VK_SUCCESS;
 }
 
-VkCommandBufferSubmitInfoKHR command_buffer_submit_info(VkCommandBuffer command_buffer, uint32_t device_mask, const void* pNext) {
-    VkCommandBufferSubmitInfoKHR command_buffer_submit_info{};
-    command_buffer_submit_info.sType         = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO_KHR;
-    command_buffer_submit_info.commandBuffer = command_buffer;
-    command_buffer_submit_info.deviceMask    = device_mask;
-    command_buffer_submit_info.pNext         = pNext;
-
-    return command_buffer_submit_info;
+VkResult command_allocator_register_thread(CommandAllocator* allocator, uint32_t* thread_index) {
+    const uint32_t index = allocator->registered_threads.fetch_add(1, std::memory_order_relaxed);
+    if (index >= allocator->thread_count) {
+        return VK_ERROR_TOO_MANY_OBJECTS;
+    }
+    *thread_index = index;
+    return VK_SUCCESS;
 }
 
-VkSubmitInfo submit_info_batch(std::span<const VkCommandBuffer> command_buffers, std::span<const VkSemaphore> wait_semaphores,
-                               std::span<const VkPipelineStageFlags> wait_semaphore_stage_flags, std::span<const VkSemaphore> signal_semaphores,
-                               const void* pNext) {
-    VkSubmitInfo submit_info{};
-    submit_info.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-    submit_info.commandBufferCount   = command_buffers.size();
-    submit_info.pCommandBuffers      = command_buffers.data();
-    submit_info.waitSemaphoreCount   = wait_semaphores.size();
-    submit_info.pWaitSemaphores      = wait_semaphores.data();
-    submit_info.pWaitDstStageMask    = wait_semaphore_stage_flags.data();
-    submit_info.signalSemaphoreCount = signal_semaphores.size();
-    submit_info.pSignalSemaphores    = signal_semaphores.data();
-    submit_info.pNext                = pNext;
-
-    return submit_info;
+VkResult command_allocator_allocate(CommandAllocator* allocator, PFN_vkAllocateCommandBuffers allocate_command_buffers, VkDevice device,
+                                    uint32_t thread_index, uint32_t queue_family_index, uint32_t frame_index, VkCommandBufferLevel level,
+                                    VkCommandBuffer* command_buffer) {
+    const auto queue_family = std::find(allocator->queue_family_indices.begin(), allocator->queue_family_indices.end(), queue_family_index);
+    if (queue_family == allocator->queue_family_indices.end() || thread_index >= allocator->thread_count ||
+        frame_index >= allocator->frame_count) {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    const size_t family_slot = queue_family - allocator->queue_family_indices.begin();
+    const size_t slot_index  = (frame_index * allocator->queue_family_indices.size() + family_slot) * allocator->thread_count + thread_index;
+
+    CommandPoolSlot*              slot            = &allocator->slots[slot_index];
+    std::vector<VkCommandBuffer>* command_buffers = &slot->command_buffers[level];
+    uint32_t*                     used_count      = &slot->used_counts[level];
+    if (*used_count == command_buffers->size()) {
+        VkCommandBufferAllocateInfo allocate_info = command_buffer_allocate_info(slot->pool, level);
+        VkCommandBuffer             new_command_buffer{};
+
+        VkResult result = allocate_command_buffers(device, &allocate_info, &new_command_buffer);
+        if (result != VK_SUCCESS) {
+            return result;
+        }
+        command_buffers->push_back(new_command_buffer);
+    }
+    *command_buffer = (*command_buffers)[(*used_count)++];
+    VK_LIB_COUNT(Allocations, 1);
+    return VK_SUCCESS;
 }
 
-VkSubmitInfo submit_info(const VkCommandBuffer* command_buffer, const VkSemaphore* wait_semaphore,
-                         const VkPipelineStageFlags* wait_semaphore_stage_flags, const VkSemaphore* signal_semaphore, const void* pNext) {
-    VkSubmitInfo submit_info{};
-    submit_info.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-    submit_info.commandBufferCount   = command_buffer == nullptr ? 0 : 1;
-    submit_info.pCommandBuffers      = command_buffer;
-    submit_info.waitSemaphoreCount   = wait_semaphore == nullptr ? 0 : 1;
-    submit_info.pWaitSemaphores      = wait_semaphore;
-    submit_info.pWaitDstStageMask    = wait_semaphore_stage_flags;
-    submit_info.signalSemaphoreCount = signal_semaphore == nullptr ? 0 : 1;
-    submit_info.pSignalSemaphores    = signal_semaphore;
-    submit_info.pNext                = pNext;
-
-    return submit_info;
+VkResult command_allocator_reset_frame(CommandAllocator* allocator, PFN_vkResetCommandPool reset_command_pool, VkDevice device,
+                                       uint32_t frame_index) {
+    const size_t frame_slot_count = allocator->queue_family_indices.size() * allocator->thread_count;
+    for (size_t i = frame_index * frame_slot_count; i < (frame_index + 1) * frame_slot_count; i++) {
+        CommandPoolSlot* slot = &allocator->slots[i];
+        // pools nothing was allocated from since the last reset are left alone
+        if (slot->used_counts[0] == 0 && slot->used_counts[1] == 0) {
+            continue;
+        }
+        VkResult result = reset_command_pool(device, slot->pool, 0);
+        if (result != VK_SUCCESS) {
+            return result;
+        }
+        slot->used_counts = {};
+    }
+    return VK_SUCCESS;
 }
 
-VkSubmitInfo2KHR submit_info_2_batch(std::span<const VkCommandBufferSubmitInfoKHR> command_buffer_submit_infos,
-                                     std::span<const VkSemaphoreSubmitInfoKHR>     wait_semaphores_submit_infos,
-                                     std::span<const VkSemaphoreSubmitInfoKHR> signal_semaphores_submit_infos, VkSubmitFlagsKHR submit_flags,
-                                     const void* pNext) {
-    VkSubmitInfo2KHR submit_info_2{};
-    submit_info_2.sType                    = VK_STRUCTURE_TYPE_SUBMIT_INFO_2_KHR;
-    submit_info_2.commandBufferInfoCount   = command_buffer_submit_infos.size();
-    submit_info_2.pCommandBufferInfos      = command_buffer_submit_infos.data();
-    submit_info_2.waitSemaphoreInfoCount   = wait_semaphores_submit_infos.size();
-    submit_info_2.pWaitSemaphoreInfos      = wait_semaphores_submit_infos.data();
-    submit_info_2.signalSemaphoreInfoCount = signal_semaphores_submit_infos.size();
-    submit_info_2.pSignalSemaphoreInfos    = signal_semaphores_submit_infos.data();
-    submit_info_2.flags                    = submit_flags;
-    submit_info_2.pNext                    = pNext;
-
-    return submit_info_2;
-}
-
-[[nodiscard]] VkSubmitInfo2KHR submit_info_2(const VkCommandBufferSubmitInfoKHR* command_buffer_submit_info,
-                                             const VkSemaphoreSubmitInfoKHR*     wait_semaphores_submit_info,
-                                             const VkSemaphoreSubmitInfoKHR* signal_semaphores_submit_info, VkSubmitFlagsKHR submit_flags,
-                                             const void* pNext) {
-    VkSubmitInfo2KHR submit_info_2{};
-    submit_info_2.sType                    = VK_STRUCTURE_TYPE_SUBMIT_INFO_2_KHR;
-    submit_info_2.commandBufferInfoCount   = command_buffer_submit_info == nullptr ? 0 : 1;
-    submit_info_2.pCommandBufferInfos      = command_buffer_submit_info;
-    submit_info_2.waitSemaphoreInfoCount   = wait_semaphores_submit_info == nullptr ? 0 : 1;
-    submit_info_2.pWaitSemaphoreInfos      = wait_semaphores_submit_info;
-    submit_info_2.signalSemaphoreInfoCount = signal_semaphores_submit_info == nullptr ? 0 : 1;
-    submit_info_2.pSignalSemaphoreInfos    = signal_semaphores_submit_info;
-    submit_info_2.flags                    = submit_flags;
-    submit_info_2.pNext                    = pNext;
-
-    return submit_info_2;
+void command_allocator_release_pools(CommandAllocator* allocator, std::vector<VkCommandPool>* pools) {
+    for (CommandPoolSlot& slot : allocator->slots) {
+        pools->push_back(slot.pool);
+    }
+    allocator->slots.clear();
 }
 
 } // namespace vk_lib
\ No newline at end of file
@@ -1,35 +1,8 @@
+#include <bit>
 #include <vk_lib/core.h>
 
 namespace vk_lib {
 
-VkApplicationInfo application_info(const char* app_name, const char* engine_name, uint32_t api_version, uint32_t app_version,
-                                   uint32_t engine_version) {
-    VkApplicationInfo application_info{};
-    application_info.sType              = VK_STRUCTURE_TYPE_APPLICATION_INFO;
-    application_info.pApplicationName   = app_name;
-    application_info.pEngineName        = engine_name;
-    application_info.apiVersion         = api_version;
-    application_info.applicationVersion = app_version;
-    application_info.engineVersion      = engine_version;
-
-    return application_info;
-}
-
-VkInstanceCreateInfo instance_create_info(const VkApplicationInfo* app_info, std::span<const char*> layers,
-                                          std::span<const char*> instance_extensions, VkInstanceCreateFlags flags, const void* pNext) {
-    VkInstanceCreateInfo instance_create_info{};
-    instance_create_info.sType                   = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
-    instance_create_info.pApplicationInfo        = app_info;
-    instance_create_info.enabledLayerCount       = layers.size();
-    instance_create_info.ppEnabledLayerNames     = layers.data();
-    instance_create_info.enabledExtensionCount   = instance_extensions.size();
-    instance_create_info.ppEnabledExtensionNames = instance_extensions.data();
-    instance_create_info.flags                   = flags;
-    instance_create_info.pNext                   = pNext;
-
-    return instance_create_info;
-}
-
 // VkResult enumerate_instance_layer_properties(std::vector<VkLayerProperties>* layer_properties) {
 //     uint32_t       layer_count = 0;
 //     const VkResult result      = vkEnumerateInstanceLayerProperties(&layer_count, nullptr);
@@ -63,31 +36,22 @@ VkInstanceCreateInfo instance_create_info(const VkApplicationInfo* app_info, std
 //     return queue_family_properties;
 // }
 
-VkDeviceQueueCreateInfo device_queue_create_info(uint32_t family_index, std::span<const float> queue_priorities, VkDeviceQueueCreateFlags flags,
-                                                 const void* pNext) {
-    VkDeviceQueueCreateInfo queue_create_info{};
-    queue_create_info.sType            = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-    queue_create_info.queueCount       = queue_priorities.size();
-    queue_create_info.queueFamilyIndex = family_index;
-    queue_create_info.pQueuePriorities = queue_priorities.data();
-    queue_create_info.flags            = flags;
-    queue_create_info.pNext            = pNext;
-
-    return queue_create_info;
-}
-
-VkDeviceCreateInfo device_create_info(std::span<const VkDeviceQueueCreateInfo> queue_create_infos, std::span<const char*> device_extensions,
-                                      const VkPhysicalDeviceFeatures* features, const void* pNext) {
-    VkDeviceCreateInfo device_create_info{};
-    device_create_info.sType                   = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
-    device_create_info.pQueueCreateInfos       = queue_create_infos.data();
-    device_create_info.queueCreateInfoCount    = queue_create_infos.size();
-    device_create_info.ppEnabledExtensionNames = device_extensions.data();
-    device_create_info.enabledExtensionCount   = device_extensions.size();
-    device_create_info.pEnabledFeatures        = features;
-    device_create_info.pNext                   = pNext;
-
-    return device_create_info;
+std::optional<uint32_t> find_queue_family_index(std::span<const VkQueueFamilyProperties> queue_family_properties, VkQueueFlags required_flags,
+                                                VkQueueFlags excluded_flags) {
+    std::optional<uint32_t> family_index{};
+    int                     fewest_extra_flags = INT32_MAX;
+    for (uint32_t i = 0; i < queue_family_properties.size(); i++) {
+        const VkQueueFlags queue_flags = queue_family_properties[i].queueFlags;
+        if (queue_family_properties[i].queueCount == 0 || (queue_flags & required_flags) != required_flags || (queue_flags & excluded_flags) != 0) {
+            continue;
+        }
+        const int extra_flags = std::popcount(queue_flags & ~required_flags);
+        if (extra_flags < fewest_extra_flags) {
+            family_index       = i;
+            fewest_extra_flags = extra_flags;
+        }
+    }
+    return family_index;
 }
 
 // VkResult create_device_with_entrypoints(VkPhysicalDevice physical_device, const VkDeviceCreateInfo* device_create_info, VkDevice* device) {
@@ -0,0 +1,78 @@
+#include <mutex>
+#include <vk_lib/counters.h>
+
+namespace vk_lib {
+
+namespace {
+
+std::mutex                          registry_mutex{};
+std::vector<const CounterTable*>    registered_tables{};
+std::array<uint64_t, counter_count> exited_thread_counts{};
+
+// registers the thread's table on construction and folds its counts into exited_thread_counts when the thread exits
+struct ThreadCounterTable {
+    CounterTable table{};
+
+    ThreadCounterTable() {
+        std::lock_guard lock(registry_mutex);
+        registered_tables.push_back(&table);
+    }
+    ~ThreadCounterTable() {
+        std::lock_guard lock(registry_mutex);
+        for (uint32_t i = 0; i < counter_count; i++) {
+            exited_thread_counts[i] += table.counts[i].load(std::memory_order_relaxed);
+        }
+        std::erase(registered_tables, &table);
+        thread_counter_table = nullptr;
+    }
+};
+
+} // namespace
+
+CounterTable* register_counter_table() {
+    thread_local ThreadCounterTable thread_table{};
+    thread_counter_table = &thread_table.table;
+    return thread_counter_table;
+}
+
+CounterSnapshot counters_snapshot() {
+    CounterSnapshot snapshot{};
+    std::lock_guard lock(registry_mutex);
+    snapshot.counts = exited_thread_counts;
+    for (const CounterTable* table : registered_tables) {
+        for (uint32_t i = 0; i < counter_count; i++) {
+            snapshot.counts[i] += table->counts[i].load(std::memory_order_relaxed);
+        }
+    }
+    return snapshot;
+}
+
+CounterSnapshot counters_frame(CounterSnapshot* previous) {
+    const CounterSnapshot current = counters_snapshot();
+    CounterSnapshot       frame{};
+    for (uint32_t i = 0; i < counter_count; i++) {
+        frame.counts[i] = current.counts[i] - previous->counts[i];
+    }
+    *previous = current;
+    return frame;
+}
+
+const char* counter_name(Counter counter) {
+    switch (counter) {
+    case Counter::Submits:
+        return "submits";
+    case Counter::Barriers:
+        return "barriers";
+    case Counter::PipelineBinds:
+        return "pipeline binds";
+    case Counter::DescriptorWrites:
+        return "descriptor writes";
+    case Counter::Allocations:
+        return "allocations";
+    case Counter::ObjectCreations:
+        return "object creations";
+    }
+    return "";
+}
+
+} // namespace vk_lib
\ No newline at end of file
@@ -0,0 +1,486 @@
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <vk_lib/counters.h>
+#include <vk_lib/descriptors.h>
+#include <vk_lib/shader_data.h>
+
+namespace vk_lib {
+
+namespace {
+
+VkResult create_pool(DescriptorAllocator* allocator, PFN_vkCreateDescriptorPool create_descriptor_pool, VkDevice device) {
+    std::vector<DescriptorTypeRatio> ratios = allocator->ratios;
+    if (allocator->observed_sets != 0) {
+        for (const auto& [type, descriptor_count] : allocator->observed_descriptors) {
+            const float observed_ratio = static_cast<float>(descriptor_count) / static_cast<float>(allocator->observed_sets);
+
+            const auto ratio = std::find_if(ratios.begin(), ratios.end(), [type](const DescriptorTypeRatio& ratio) { return ratio.type == type; });
+            if (ratio == ratios.end()) {
+                ratios.push_back({type, observed_ratio});
+            } else {
+                ratio->descriptors_per_set = std::max(ratio->descriptors_per_set, observed_ratio);
+            }
+        }
+    }
+
+    std::vector<VkDescriptorPoolSize> pool_sizes;
+    pool_sizes.reserve(ratios.size());
+    for (const DescriptorTypeRatio& ratio : ratios) {
+        const auto descriptor_count = static_cast<uint32_t>(std::ceil(ratio.descriptors_per_set * static_cast<float>(allocator->sets_per_pool)));
+        if (descriptor_count != 0) {
+            pool_sizes.push_back(descriptor_pool_size(ratio.type, descriptor_count));
+        }
+    }
+
+    VkDescriptorPoolCreateInfo create_info = descriptor_pool_create_info(allocator->sets_per_pool, pool_sizes, allocator->pool_flags);
+    VkDescriptorPool           pool{};
+    VK_LIB_COUNT(ObjectCreations, 1);
+    VkResult result = create_descriptor_pool(device, &create_info, nullptr, &pool);
+    if (result != VK_SUCCESS) {
+        return result;
+    }
+    allocator->ready_pools.push_back(pool);
+    allocator->sets_per_pool = std::min(allocator->sets_per_pool + allocator->sets_per_pool / 2, allocator->max_sets_per_pool);
+    return VK_SUCCESS;
+}
+
+constexpr uint32_t null_slot = UINT32_MAX;
+
+uint64_t pack_head(uint32_t slot, uint64_t head) { return ((head >> 32) + 1) << 32 | slot; }
+
+void slot_list_init(BindlessSlotList* slot_list, uint32_t capacity) {
+    slot_list->next_slots = std::make_unique<std::atomic<uint32_t>[]>(capacity);
+    slot_list->capacity   = capacity;
+    for (uint32_t i = 0; i < capacity; i++) {
+        slot_list->next_slots[i].store(i + 1 < capacity ? i + 1 : null_slot, std::memory_order_relaxed);
+    }
+    slot_list->head.store(capacity != 0 ? 0 : null_slot, std::memory_order_release);
+}
+
+size_t descriptor_size(const DescriptorBuffer* descriptor_buffer, VkDescriptorType type) {
+    const VkPhysicalDeviceDescriptorBufferPropertiesEXT* properties = &descriptor_buffer->properties;
+    const bool                                           robust     = descriptor_buffer->robust_buffer_access;
+    switch (type) {
+    case VK_DESCRIPTOR_TYPE_SAMPLER:
+        return properties->samplerDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        return properties->combinedImageSamplerDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        return properties->sampledImageDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        return properties->storageImageDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+        return robust ? properties->robustUniformTexelBufferDescriptorSize : properties->uniformTexelBufferDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+        return robust ? properties->robustStorageTexelBufferDescriptorSize : properties->storageTexelBufferDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        return robust ? properties->robustUniformBufferDescriptorSize : properties->uniformBufferDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        return robust ? properties->robustStorageBufferDescriptorSize : properties->storageBufferDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+        return properties->inputAttachmentDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
+        return properties->accelerationStructureDescriptorSize;
+    default:
+        return 0;
+    }
+}
+
+enum class DescriptorInfoKind : uint8_t {
+    None,
+    Image,
+    Buffer,
+    TexelBuffer,
+};
+
+// which info array of VkWriteDescriptorSet, and which info type in template data, a descriptor type uses
+DescriptorInfoKind descriptor_info_kind(VkDescriptorType type) {
+    switch (type) {
+    case VK_DESCRIPTOR_TYPE_SAMPLER:
+    case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+    case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+    case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+    case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+        return DescriptorInfoKind::Image;
+    case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+    case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+        return DescriptorInfoKind::Buffer;
+    case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+    case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+        return DescriptorInfoKind::TexelBuffer;
+    default:
+        return DescriptorInfoKind::None;
+    }
+}
+
+} // namespace
+
+DescriptorAllocator descriptor_allocator(std::span<const DescriptorTypeRatio> ratios, uint32_t initial_sets_per_pool, uint32_t max_sets_per_pool,
+                                         VkDescriptorPoolCreateFlags pool_flags) {
+    DescriptorAllocator allocator{};
+    allocator.ratios.assign(ratios.begin(), ratios.end());
+    allocator.sets_per_pool     = std::min(initial_sets_per_pool, max_sets_per_pool);
+    allocator.max_sets_per_pool = max_sets_per_pool;
+    allocator.pool_flags        = pool_flags;
+
+    return allocator;
+}
+
+VkResult descriptor_allocator_allocate(DescriptorAllocator* allocator, PFN_vkCreateDescriptorPool create_descriptor_pool,
+                                       PFN_vkAllocateDescriptorSets allocate_descriptor_sets, VkDevice device, VkDescriptorSetLayout set_layout,
+                                       VkDescriptorSet* descriptor_set, std::span<const VkDescriptorPoolSize> layout_sizes, const void* pNext) {
+    if (!layout_sizes.empty()) {
+        allocator->observed_sets++;
+        for (const VkDescriptorPoolSize& layout_size : layout_sizes) {
+            allocator->observed_descriptors[layout_size.type] += layout_size.descriptorCount;
+        }
+    }
+
+    while (true) {
+        const bool fresh_pool = allocator->ready_pools.empty();
+        if (fresh_pool) {
+            VkResult result = create_pool(allocator, create_descriptor_pool, device);
+            if (result != VK_SUCCESS) {
+                return result;
+            }
+        }
+        VkDescriptorSetAllocateInfo allocate_info = descriptor_set_allocate_info(&set_layout, allocator->ready_pools.back(), 1, pNext);
+        VkResult                    result        = allocate_descriptor_sets(device, &allocate_info, descriptor_set);
+        if (result != VK_ERROR_OUT_OF_POOL_MEMORY && result != VK_ERROR_FRAGMENTED_POOL) {
+            if (result == VK_SUCCESS) {
+                VK_LIB_COUNT(Allocations, 1);
+            }
+            return result;
+        }
+        allocator->full_pools.push_back(allocator->ready_pools.back());
+        allocator->ready_pools.pop_back();
+        // the set does not fit an empty pool, its layout needs more descriptors than the ratios provide
+        if (fresh_pool) {
+            return result;
+        }
+    }
+}
+
+VkResult descriptor_allocator_reset(DescriptorAllocator* allocator, PFN_vkResetDescriptorPool reset_descriptor_pool, VkDevice device) {
+    allocator->ready_pools.insert(allocator->ready_pools.end(), allocator->full_pools.begin(), allocator->full_pools.end());
+    allocator->full_pools.clear();
+    for (VkDescriptorPool pool : allocator->ready_pools) {
+        VkResult result = reset_descriptor_pool(device, pool, 0);
+        if (result != VK_SUCCESS) {
+            return result;
+        }
+    }
+    return VK_SUCCESS;
+}
+
+void descriptor_allocator_release_pools(DescriptorAllocator* allocator, std::vector<VkDescriptorPool>* pools) {
+    pools->insert(pools->end(), allocator->ready_pools.begin(), allocator->ready_pools.end());
+    pools->insert(pools->end(), allocator->full_pools.begin(), allocator->full_pools.end());
+    allocator->ready_pools.clear();
+    allocator->full_pools.clear();
+}
+
+void bindless_heap_init(BindlessHeap* heap, uint32_t sampled_image_count, uint32_t storage_image_count, uint32_t storage_buffer_count) {
+    slot_list_init(&heap->slot_lists[static_cast<uint32_t>(BindlessResourceType::SampledImage)], sampled_image_count);
+    slot_list_init(&heap->slot_lists[static_cast<uint32_t>(BindlessResourceType::StorageImage)], storage_image_count);
+    slot_list_init(&heap->slot_lists[static_cast<uint32_t>(BindlessResourceType::StorageBuffer)], storage_buffer_count);
+    // slots that were never written are not accessed by shaders, and writes may land while the set is in use
+    heap->binding_flags.fill(VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT |
+                             VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT);
+    heap->pending_writes.clear();
+}
+
+std::array<VkDescriptorSetLayoutBinding, bindless_resource_type_count> bindless_heap_layout_bindings(const BindlessHeap* heap) {
+    std::array<VkDescriptorSetLayoutBinding, bindless_resource_type_count> bindings{};
+    for (uint32_t i = 0; i < bindless_resource_type_count; i++) {
+        bindings[i] = descriptor_set_layout_binding(i, bindless_descriptor_types[i], heap->slot_lists[i].capacity);
+    }
+    return bindings;
+}
+
+std::array<VkDescriptorPoolSize, bindless_resource_type_count> bindless_heap_pool_sizes(const BindlessHeap* heap) {
+    std::array<VkDescriptorPoolSize, bindless_resource_type_count> pool_sizes{};
+    for (uint32_t i = 0; i < bindless_resource_type_count; i++) {
+        // a descriptor count of 0 is invalid even for an unused array
+        pool_sizes[i] = descriptor_pool_size(bindless_descriptor_types[i], std::max(heap->slot_lists[i].capacity, 1u));
+    }
+    return pool_sizes;
+}
+
+VkResult bindless_heap_allocate(BindlessHeap* heap, BindlessResourceType type, uint32_t* slot) {
+    BindlessSlotList* slot_list = &heap->slot_lists[static_cast<uint32_t>(type)];
+    uint64_t          head      = slot_list->head.load(std::memory_order_acquire);
+    while (true) {
+        const auto top_slot = static_cast<uint32_t>(head);
+        if (top_slot == null_slot) {
+            return VK_ERROR_OUT_OF_POOL_MEMORY;
+        }
+        const uint32_t next_slot = slot_list->next_slots[top_slot].load(std::memory_order_relaxed);
+        if (slot_list->head.compare_exchange_weak(head, pack_head(next_slot, head), std::memory_order_acquire, std::memory_order_acquire)) {
+            *slot = top_slot;
+            return VK_SUCCESS;
+        }
+    }
+}
+
+void bindless_heap_free(BindlessHeap* heap, BindlessResourceType type, uint32_t slot) {
+    BindlessSlotList* slot_list = &heap->slot_lists[static_cast<uint32_t>(type)];
+    uint64_t          head      = slot_list->head.load(std::memory_order_relaxed);
+    do {
+        slot_list->next_slots[slot].store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+    } while (!slot_list->head.compare_exchange_weak(head, pack_head(slot, head), std::memory_order_release, std::memory_order_relaxed));
+}
+
+void bindless_heap_write_image(BindlessHeap* heap, BindlessResourceType type, uint32_t slot, VkImageView image_view, VkImageLayout image_layout) {
+    BindlessWrite write{};
+    write.type       = type;
+    write.slot       = slot;
+    write.image_info = descriptor_image_info(image_view, image_layout);
+
+    std::lock_guard lock(heap->write_mutex);
+    heap->pending_writes.push_back(write);
+}
+
+void bindless_heap_write_buffer(BindlessHeap* heap, uint32_t slot, VkBuffer buffer, uint64_t offset, uint64_t range) {
+    BindlessWrite write{};
+    write.type        = BindlessResourceType::StorageBuffer;
+    write.slot        = slot;
+    write.buffer_info = descriptor_buffer_info(buffer, offset, range);
+
+    std::lock_guard lock(heap->write_mutex);
+    heap->pending_writes.push_back(write);
+}
+
+void bindless_heap_flush(BindlessHeap* heap, PFN_vkUpdateDescriptorSets update_descriptor_sets, VkDevice device) {
+    std::vector<BindlessWrite> pending_writes;
+    {
+        std::lock_guard lock(heap->write_mutex);
+        pending_writes.swap(heap->pending_writes);
+    }
+    if (pending_writes.empty()) {
+        return;
+    }
+
+    // the stable sort keeps repeated writes to a slot in submission order, the last of them wins
+    std::stable_sort(pending_writes.begin(), pending_writes.end(), [](const BindlessWrite& a, const BindlessWrite& b) {
+        return a.type != b.type ? a.type < b.type : a.slot < b.slot;
+    });
+
+    // reserved up front, the writes point into these
+    std::vector<VkDescriptorImageInfo>  image_infos;
+    std::vector<VkDescriptorBufferInfo> buffer_infos;
+    std::vector<VkWriteDescriptorSet>   writes;
+    image_infos.reserve(pending_writes.size());
+    buffer_infos.reserve(pending_writes.size());
+
+    for (size_t i = 0; i < pending_writes.size(); i++) {
+        const BindlessWrite* pending_write = &pending_writes[i];
+        if (i + 1 < pending_writes.size() && pending_writes[i + 1].type == pending_write->type && pending_writes[i + 1].slot == pending_write->slot) {
+            continue;
+        }
+        const auto binding   = static_cast<uint32_t>(pending_write->type);
+        const bool is_buffer = pending_write->type == BindlessResourceType::StorageBuffer;
+
+        VkWriteDescriptorSet* previous = writes.empty() ? nullptr : &writes.back();
+        if (previous != nullptr && previous->dstBinding == binding && previous->dstArrayElement + previous->descriptorCount == pending_write->slot) {
+            previous->descriptorCount++;
+        } else {
+            writes.push_back(write_descriptor_set(binding, bindless_descriptor_types[binding], heap->descriptor_set,
+                                                  is_buffer ? nullptr : image_infos.data() + image_infos.size(),
+                                                  is_buffer ? buffer_infos.data() + buffer_infos.size() : nullptr, nullptr, pending_write->slot));
+        }
+        if (is_buffer) {
+            buffer_infos.push_back(pending_write->buffer_info);
+        } else {
+            image_infos.push_back(pending_write->image_info);
+        }
+    }
+
+    VK_LIB_COUNT(DescriptorWrites, writes.size());
+    update_descriptor_sets(device, writes.size(), writes.data(), 0, nullptr);
+}
+
+DescriptorBufferSetLayout descriptor_buffer_set_layout(PFN_vkGetDescriptorSetLayoutSizeEXT           get_set_layout_size,
+                                                       PFN_vkGetDescriptorSetLayoutBindingOffsetEXT  get_binding_offset, VkDevice device,
+                                                       VkDescriptorSetLayout                         set_layout,
+                                                       std::span<const VkDescriptorSetLayoutBinding> bindings) {
+    DescriptorBufferSetLayout buffer_set_layout{};
+    buffer_set_layout.set_layout = set_layout;
+    get_set_layout_size(device, set_layout, &buffer_set_layout.size);
+
+    for (const VkDescriptorSetLayoutBinding& binding : bindings) {
+        if (binding.binding >= buffer_set_layout.bindings.size()) {
+            buffer_set_layout.bindings.resize(binding.binding + 1);
+        }
+        DescriptorBufferBinding* buffer_binding = &buffer_set_layout.bindings[binding.binding];
+        buffer_binding->type                    = binding.descriptorType;
+        get_binding_offset(device, set_layout, binding.binding, &buffer_binding->offset);
+    }
+
+    return buffer_set_layout;
+}
+
+DescriptorBuffer descriptor_buffer(VkBuffer buffer, void* mapped_data, VkDeviceAddress device_address, uint64_t size, VkBufferUsageFlags usage,
+                                   const VkPhysicalDeviceDescriptorBufferPropertiesEXT* properties, bool robust_buffer_access) {
+    DescriptorBuffer descriptor_buffer{};
+    descriptor_buffer.buffer               = buffer;
+    descriptor_buffer.mapped_data          = mapped_data;
+    descriptor_buffer.device_address       = device_address;
+    descriptor_buffer.size                 = size;
+    descriptor_buffer.usage                = usage;
+    descriptor_buffer.properties           = *properties;
+    descriptor_buffer.properties.pNext     = nullptr;
+    descriptor_buffer.robust_buffer_access = robust_buffer_access;
+
+    return descriptor_buffer;
+}
+
+VkResult descriptor_buffer_allocate(DescriptorBuffer* descriptor_buffer, const DescriptorBufferSetLayout* set_layout, uint64_t* set_offset) {
+    const uint64_t alignment = std::max<uint64_t>(descriptor_buffer->properties.descriptorBufferOffsetAlignment, 1);
+    const uint64_t offset    = (descriptor_buffer->used_size + alignment - 1) / alignment * alignment;
+    if (offset + set_layout->size > descriptor_buffer->size) {
+        return VK_ERROR_OUT_OF_POOL_MEMORY;
+    }
+    descriptor_buffer->used_size = offset + set_layout->size;
+    *set_offset                  = offset;
+    return VK_SUCCESS;
+}
+
+void descriptor_buffer_reset(DescriptorBuffer* descriptor_buffer) { descriptor_buffer->used_size = 0; }
+
+void descriptor_buffer_write(const DescriptorBuffer* descriptor_buffer, PFN_vkGetDescriptorEXT get_descriptor, VkDevice device,
+                             const DescriptorBufferSetLayout* set_layout, uint64_t set_offset, uint32_t binding,
+                             const VkDescriptorGetInfoEXT* get_info, uint32_t array_element) {
+    const size_t   size   = descriptor_size(descriptor_buffer, get_info->type);
+    const uint64_t offset = set_offset + set_layout->bindings[binding].offset + array_element * size;
+    VK_LIB_COUNT(DescriptorWrites, 1);
+    get_descriptor(device, get_info, size, static_cast<uint8_t*>(descriptor_buffer->mapped_data) + offset);
+}
+
+VkDescriptorBufferBindingInfoEXT descriptor_buffer_binding_info(const DescriptorBuffer* descriptor_buffer) {
+    return descriptor_buffer_binding_info_ext(descriptor_buffer->device_address, descriptor_buffer->usage);
+}
+
+DescriptorTemplateLayout descriptor_template_layout(std::span<const VkDescriptorSetLayoutBinding> bindings) {
+    DescriptorTemplateLayout template_layout{};
+    for (const VkDescriptorSetLayoutBinding& binding : bindings) {
+        size_t stride = 0;
+        switch (descriptor_info_kind(binding.descriptorType)) {
+        case DescriptorInfoKind::Image:
+            stride = sizeof(VkDescriptorImageInfo);
+            break;
+        case DescriptorInfoKind::Buffer:
+            stride = sizeof(VkDescriptorBufferInfo);
+            break;
+        case DescriptorInfoKind::TexelBuffer:
+            stride = sizeof(VkBufferView);
+            break;
+        case DescriptorInfoKind::None:
+            // inline uniform block bytes, or handles like acceleration structures
+            stride = binding.descriptorType == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK ? 1 : sizeof(uint64_t);
+            break;
+        }
+        if (binding.descriptorCount != 0) {
+            // offsets are assigned once the entries are sorted
+            template_layout.entries.push_back(
+                descriptor_update_template_entry(binding.binding, binding.descriptorType, 0, stride, binding.descriptorCount));
+        }
+    }
+    std::sort(template_layout.entries.begin(), template_layout.entries.end(),
+              [](const VkDescriptorUpdateTemplateEntry& a, const VkDescriptorUpdateTemplateEntry& b) { return a.dstBinding < b.dstBinding; });
+
+    // every info type holds 8 byte members
+    for (VkDescriptorUpdateTemplateEntry& entry : template_layout.entries) {
+        entry.offset              = (template_layout.data_size + 7) / 8 * 8;
+        template_layout.data_size = entry.offset + entry.stride * entry.descriptorCount;
+    }
+
+    return template_layout;
+}
+
+size_t descriptor_template_offset(const DescriptorTemplateLayout* template_layout, uint32_t binding, uint32_t array_element) {
+    const auto entry = std::find_if(template_layout->entries.begin(), template_layout->entries.end(),
+                                    [binding](const VkDescriptorUpdateTemplateEntry& entry) { return entry.dstBinding == binding; });
+    assert(entry != template_layout->entries.end() && "binding is not part of the template layout");
+    return entry->offset + entry->stride * array_element;
+}
+
+void descriptor_template_write_image(const DescriptorTemplateLayout* template_layout, void* data, uint32_t binding, VkDescriptorImageInfo image_info,
+                                     uint32_t array_element) {
+    memcpy(static_cast<uint8_t*>(data) + descriptor_template_offset(template_layout, binding, array_element), &image_info, sizeof(image_info));
+}
+
+void descriptor_template_write_buffer(const DescriptorTemplateLayout* template_layout, void* data, uint32_t binding,
+                                      VkDescriptorBufferInfo buffer_info, uint32_t array_element) {
+    memcpy(static_cast<uint8_t*>(data) + descriptor_template_offset(template_layout, binding, array_element), &buffer_info, sizeof(buffer_info));
+}
+
+void descriptor_template_write_texel_buffer(const DescriptorTemplateLayout* template_layout, void* data, uint32_t binding,
+                                            VkBufferView texel_buffer_view, uint32_t array_element) {
+    memcpy(static_cast<uint8_t*>(data) + descriptor_template_offset(template_layout, binding, array_element), &texel_buffer_view,
+           sizeof(texel_buffer_view));
+}
+
+void descriptor_write_batch_add(DescriptorWriteBatch* batch, const VkWriteDescriptorSet* write) {
+    VkWriteDescriptorSet batched_write = *write;
+    batched_write.pImageInfo           = nullptr;
+    batched_write.pBufferInfo          = nullptr;
+    batched_write.pTexelBufferView     = nullptr;
+
+    size_t info_offset = 0;
+    switch (descriptor_info_kind(write->descriptorType)) {
+    case DescriptorInfoKind::Image:
+        info_offset = batch->image_infos.size();
+        batch->image_infos.insert(batch->image_infos.end(), write->pImageInfo, write->pImageInfo + write->descriptorCount);
+        break;
+    case DescriptorInfoKind::Buffer:
+        info_offset = batch->buffer_infos.size();
+        batch->buffer_infos.insert(batch->buffer_infos.end(), write->pBufferInfo, write->pBufferInfo + write->descriptorCount);
+        break;
+    case DescriptorInfoKind::TexelBuffer:
+        info_offset = batch->texel_buffer_views.size();
+        batch->texel_buffer_views.insert(batch->texel_buffer_views.end(), write->pTexelBufferView, write->pTexelBufferView + write->descriptorCount);
+        break;
+    case DescriptorInfoKind::None:
+        break;
+    }
+    batch->writes.push_back(batched_write);
+    batch->info_offsets.push_back(info_offset);
+}
+
+void descriptor_write_batch_flush(DescriptorWriteBatch* batch, PFN_vkUpdateDescriptorSets update_descriptor_sets, VkDevice device) {
+    if (batch->writes.empty()) {
+        return;
+    }
+    for (size_t i = 0; i < batch->writes.size(); i++) {
+        VkWriteDescriptorSet* write = &batch->writes[i];
+        switch (descriptor_info_kind(write->descriptorType)) {
+        case DescriptorInfoKind::Image:
+            write->pImageInfo = batch->image_infos.data() + batch->info_offsets[i];
+            break;
+        case DescriptorInfoKind::Buffer:
+            write->pBufferInfo = batch->buffer_infos.data() + batch->info_offsets[i];
+            break;
+        case DescriptorInfoKind::TexelBuffer:
+            write->pTexelBufferView = batch->texel_buffer_views.data() + batch->info_offsets[i];
+            break;
+        case DescriptorInfoKind::None:
+            break;
+        }
+    }
+
+    VK_LIB_COUNT(DescriptorWrites, batch->writes.size());
+    update_descriptor_sets(device, batch->writes.size(), batch->writes.data(), 0, nullptr);
+
+    batch->writes.clear();
+    batch->info_offsets.clear();
+    batch->image_infos.clear();
+    batch->buffer_infos.clear();
+    batch->texel_buffer_views.clear();
+}
+
+} // namespace vk_lib
\ No newline at end of file
@@ -0,0 +1,163 @@
+#include <algorithm>
+#include <vk_lib/jobs.h>
+
+namespace vk_lib {
+
+namespace {
+
+thread_local const JobSystem* current_job_system{};
+thread_local uint32_t         current_thread_index{};
+
+// threads that neither run the system's jobs nor started it have no index, so they never run jobs
+constexpr uint32_t no_thread_index = UINT32_MAX;
+
+uint32_t thread_index(const JobSystem* job_system) { return current_job_system == job_system ? current_thread_index : no_thread_index; }
+
+bool take_job(JobSystem* job_system, uint32_t thread_index, QueuedJob* queued_job) {
+    // the own deque is used like a stack, the others like queues
+    {
+        JobQueue&        queue = job_system->queues[thread_index];
+        std::unique_lock lock(queue.mutex);
+        if (!queue.jobs.empty()) {
+            *queued_job = std::move(queue.jobs.back());
+            queue.jobs.pop_back();
+            return true;
+        }
+    }
+    for (uint32_t i = 1; i < job_system->queue_count; i++) {
+        JobQueue&        queue = job_system->queues[(thread_index + i) % job_system->queue_count];
+        std::unique_lock lock(queue.mutex);
+        if (!queue.jobs.empty()) {
+            *queued_job = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+bool run_job(JobSystem* job_system, uint32_t thread_index) {
+    QueuedJob queued_job;
+    if (!take_job(job_system, thread_index, &queued_job)) {
+        return false;
+    }
+    job_system->queued_jobs.fetch_sub(1, std::memory_order_relaxed);
+    queued_job.job(thread_index);
+    queued_job.counter->remaining_jobs.fetch_sub(1, std::memory_order_acq_rel);
+    return true;
+}
+
+void worker_loop(JobSystem* job_system, uint32_t thread_index) {
+    current_job_system   = job_system;
+    current_thread_index = thread_index;
+    while (true) {
+        if (run_job(job_system, thread_index)) {
+            continue;
+        }
+        std::unique_lock lock(job_system->sleep_mutex);
+        if (job_system->stopping && job_system->queued_jobs.load(std::memory_order_relaxed) == 0) {
+            return;
+        }
+        job_system->wake_condition.wait(lock, [job_system] {
+            return job_system->stopping || job_system->queued_jobs.load(std::memory_order_relaxed) != 0;
+        });
+    }
+}
+
+} // namespace
+
+void job_system_start(JobSystem* job_system, uint32_t worker_count) {
+    if (worker_count == 0) {
+        worker_count = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+    }
+    job_system->queue_count = worker_count + 1;
+    job_system->queues      = std::make_unique<JobQueue[]>(job_system->queue_count);
+    job_system->stopping    = false;
+    current_job_system      = job_system;
+    current_thread_index    = worker_count;
+    job_system->workers.reserve(worker_count);
+    for (uint32_t i = 0; i < worker_count; i++) {
+        job_system->workers.emplace_back(worker_loop, job_system, i);
+    }
+}
+
+void job_system_stop(JobSystem* job_system) {
+    {
+        std::unique_lock lock(job_system->sleep_mutex);
+        job_system->stopping = true;
+    }
+    job_system->wake_condition.notify_all();
+    for (std::thread& worker : job_system->workers) {
+        worker.join();
+    }
+    job_system->workers.clear();
+    // jobs queued by the starting thread after the workers left
+    while (run_job(job_system, job_system->queue_count - 1)) {
+    }
+    if (current_job_system == job_system) {
+        current_job_system = nullptr;
+    }
+}
+
+void job_system_submit(JobSystem* job_system, JobCounter* counter, Job job) {
+    counter->remaining_jobs.fetch_add(1, std::memory_order_relaxed);
+    // counted before it is pushed so a worker checking for jobs never misses it
+    job_system->queued_jobs.fetch_add(1, std::memory_order_relaxed);
+    {
+        const uint32_t   index = thread_index(job_system);
+        JobQueue&        queue = job_system->queues[index != no_thread_index ? index : job_system->queue_count - 1];
+        std::unique_lock lock(queue.mutex);
+        queue.jobs.push_back({std::move(job), counter});
+    }
+    // taking the lock orders the notification after a worker's check of queued_jobs
+    { std::unique_lock lock(job_system->sleep_mutex); }
+    job_system->wake_condition.notify_one();
+}
+
+void job_system_wait(JobSystem* job_system, JobCounter* counter) {
+    const uint32_t index = thread_index(job_system);
+    while (counter->remaining_jobs.load(std::memory_order_acquire) != 0) {
+        if (index == no_thread_index || !run_job(job_system, index)) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+VkResult record_secondary_command_buffers(JobSystem* job_system, CommandAllocator* command_allocator, const SecondaryCommandFunctions* functions,
+                                          VkDevice device, uint32_t queue_family_index, uint32_t frame_index, VkCommandBufferUsageFlags usage_flags,
+                                          const VkCommandBufferInheritanceInfo* inheritance_info, uint32_t chunk_count,
+                                          const RecordChunk& record_chunk, VkCommandBuffer primary_command_buffer) {
+    std::vector<VkCommandBuffer> command_buffers(chunk_count);
+    std::vector<VkResult>        results(chunk_count, VK_SUCCESS);
+    JobCounter                   counter;
+    for (uint32_t chunk = 0; chunk < chunk_count; chunk++) {
+        job_system_submit(job_system, &counter, [&, chunk](uint32_t thread_index) {
+            VkCommandBuffer& command_buffer = command_buffers[chunk];
+            results[chunk] = command_allocator_allocate(command_allocator, functions->allocate_command_buffers, device, thread_index,
+                                                        queue_family_index, frame_index, VK_COMMAND_BUFFER_LEVEL_SECONDARY, &command_buffer);
+            if (results[chunk] != VK_SUCCESS) {
+                return;
+            }
+            const VkCommandBufferBeginInfo begin_info = command_buffer_begin_info(usage_flags, inheritance_info);
+            results[chunk]                            = functions->begin_command_buffer(command_buffer, &begin_info);
+            if (results[chunk] != VK_SUCCESS) {
+                return;
+            }
+            record_chunk(command_buffer, chunk);
+            results[chunk] = functions->end_command_buffer(command_buffer);
+        });
+    }
+    job_system_wait(job_system, &counter);
+
+    for (VkResult result : results) {
+        if (result != VK_SUCCESS) {
+            return result;
+        }
+    }
+    if (chunk_count != 0) {
+        functions->cmd_execute_commands(primary_command_buffer, chunk_count, command_buffers.data());
+    }
+    return VK_SUCCESS;
+}
+
+} // namespace vk_lib
\ No newline at end of file
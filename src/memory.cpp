@@ -0,0 +1,338 @@
+#include <algorithm>
+#include <bit>
+#include <vk_lib/counters.h>
+#include <vk_lib/memory.h>
+
+namespace vk_lib {
+
+std::optional<uint32_t> find_memory_type_index(const VkPhysicalDeviceMemoryProperties* memory_properties, uint32_t memory_type_bits,
+                                               VkMemoryPropertyFlags required_flags, VkMemoryPropertyFlags preferred_flags) {
+    std::optional<uint32_t> fallback_index{};
+    for (uint32_t i = 0; i < memory_properties->memoryTypeCount; i++) {
+        if ((memory_type_bits & (1u << i)) == 0) {
+            continue;
+        }
+        const VkMemoryPropertyFlags property_flags = memory_properties->memoryTypes[i].propertyFlags;
+        if ((property_flags & required_flags) != required_flags) {
+            continue;
+        }
+        if ((property_flags & preferred_flags) == preferred_flags) {
+            return i;
+        }
+        if (!fallback_index.has_value()) {
+            fallback_index = i;
+        }
+    }
+    return fallback_index;
+}
+
+namespace {
+
+uint64_t align_up(uint64_t value, uint64_t alignment) { return (value + alignment - 1) / alignment * alignment; }
+
+uint32_t free_list_index(uint32_t fl, uint32_t sl) { return fl * tlsf_sl_index_count + sl; }
+
+// maps a size to the bucket it is stored in
+void mapping_insert(uint64_t size, uint32_t* fl, uint32_t* sl) {
+    constexpr uint64_t small_block_size = 1ull << tlsf_fl_index_shift;
+    if (size < small_block_size) {
+        *fl = 0;
+        *sl = static_cast<uint32_t>(size / (small_block_size / tlsf_sl_index_count));
+        return;
+    }
+    const uint32_t msb = std::bit_width(size) - 1;
+    *sl                = static_cast<uint32_t>((size >> (msb - tlsf_sl_index_count_log2)) ^ tlsf_sl_index_count);
+    *fl                = msb - tlsf_fl_index_shift + 1;
+}
+
+// maps a size to the first bucket whose ranges are all at least that size
+void mapping_search(uint64_t size, uint32_t* fl, uint32_t* sl) {
+    constexpr uint64_t small_block_size = 1ull << tlsf_fl_index_shift;
+    if (size < small_block_size) {
+        size = align_up(size, small_block_size / tlsf_sl_index_count);
+    } else {
+        const uint32_t msb   = std::bit_width(size) - 1;
+        const uint64_t round = (1ull << (msb - tlsf_sl_index_count_log2)) - 1;
+        size                 = size > UINT64_MAX - round ? UINT64_MAX : size + round;
+    }
+    mapping_insert(size, fl, sl);
+}
+
+uint32_t acquire_node(TlsfAllocator* allocator) {
+    if (!allocator->unused_nodes.empty()) {
+        const uint32_t node_index = allocator->unused_nodes.back();
+        allocator->unused_nodes.pop_back();
+        allocator->nodes[node_index] = TlsfNode{};
+        return node_index;
+    }
+    allocator->nodes.emplace_back();
+    return static_cast<uint32_t>(allocator->nodes.size() - 1);
+}
+
+void release_node(TlsfAllocator* allocator, uint32_t node_index) {
+    allocator->nodes[node_index] = TlsfNode{};
+    allocator->unused_nodes.push_back(node_index);
+}
+
+void insert_free_node(TlsfAllocator* allocator, uint32_t node_index) {
+    TlsfNode* node = &allocator->nodes[node_index];
+    uint32_t  fl, sl;
+    mapping_insert(node->size, &fl, &sl);
+
+    const uint32_t list_index = free_list_index(fl, sl);
+    const uint32_t head_index = allocator->free_heads[list_index];
+    node->free                = true;
+    node->prev_free           = tlsf_null_index;
+    node->next_free           = head_index;
+    if (head_index != tlsf_null_index) {
+        allocator->nodes[head_index].prev_free = node_index;
+    }
+    allocator->free_heads[list_index] = node_index;
+    allocator->fl_bitmap |= 1ull << fl;
+    allocator->sl_bitmaps[fl] |= 1u << sl;
+}
+
+void remove_free_node(TlsfAllocator* allocator, uint32_t node_index) {
+    TlsfNode* node = &allocator->nodes[node_index];
+    uint32_t  fl, sl;
+    mapping_insert(node->size, &fl, &sl);
+
+    if (node->prev_free != tlsf_null_index) {
+        allocator->nodes[node->prev_free].next_free = node->next_free;
+    }
+    if (node->next_free != tlsf_null_index) {
+        allocator->nodes[node->next_free].prev_free = node->prev_free;
+    }
+    const uint32_t list_index = free_list_index(fl, sl);
+    if (allocator->free_heads[list_index] == node_index) {
+        allocator->free_heads[list_index] = node->next_free;
+        if (node->next_free == tlsf_null_index) {
+            allocator->sl_bitmaps[fl] &= ~(1u << sl);
+            if (allocator->sl_bitmaps[fl] == 0) {
+                allocator->fl_bitmap &= ~(1ull << fl);
+            }
+        }
+    }
+    node->free      = false;
+    node->prev_free = tlsf_null_index;
+    node->next_free = tlsf_null_index;
+}
+
+// returns the head of the first non-empty list at or above (fl, sl)
+uint32_t find_free_node(const TlsfAllocator* allocator, uint32_t fl, uint32_t sl) {
+    if (fl >= tlsf_fl_index_count) {
+        return tlsf_null_index;
+    }
+    uint32_t sl_map = sl < tlsf_sl_index_count ? allocator->sl_bitmaps[fl] & (~0u << sl) : 0;
+    if (sl_map == 0) {
+        const uint64_t fl_map = fl + 1 < 64 ? allocator->fl_bitmap & (~0ull << (fl + 1)) : 0;
+        if (fl_map == 0) {
+            return tlsf_null_index;
+        }
+        fl     = std::countr_zero(fl_map);
+        sl_map = allocator->sl_bitmaps[fl];
+    }
+    sl = std::countr_zero(sl_map);
+    return allocator->free_heads[free_list_index(fl, sl)];
+}
+
+// inserts a new node covering [offset, offset + size) physically before or after node_index
+uint32_t split_node(TlsfAllocator* allocator, uint32_t node_index, uint64_t offset, uint64_t size, bool before) {
+    const uint32_t split_index = acquire_node(allocator);
+    TlsfNode*      node        = &allocator->nodes[node_index];
+    TlsfNode*      split       = &allocator->nodes[split_index];
+    split->offset              = offset;
+    split->size                = size;
+    split->block               = node->block;
+    if (before) {
+        split->prev_physical = node->prev_physical;
+        split->next_physical = node_index;
+        if (node->prev_physical != tlsf_null_index) {
+            allocator->nodes[node->prev_physical].next_physical = split_index;
+        }
+        node->prev_physical = split_index;
+    } else {
+        split->prev_physical = node_index;
+        split->next_physical = node->next_physical;
+        if (node->next_physical != tlsf_null_index) {
+            allocator->nodes[node->next_physical].prev_physical = split_index;
+        }
+        node->next_physical = split_index;
+    }
+    return split_index;
+}
+
+// folds next_index into node_index, both must be physically adjacent
+void merge_nodes(TlsfAllocator* allocator, uint32_t node_index, uint32_t next_index) {
+    TlsfNode* node = &allocator->nodes[node_index];
+    TlsfNode* next = &allocator->nodes[next_index];
+    node->size += next->size;
+    node->next_physical = next->next_physical;
+    if (next->next_physical != tlsf_null_index) {
+        allocator->nodes[next->next_physical].prev_physical = node_index;
+    }
+    release_node(allocator, next_index);
+}
+
+bool node_fits(const TlsfNode* node, uint64_t size, uint64_t alignment) {
+    const uint64_t aligned_offset = align_up(node->offset, alignment);
+    return aligned_offset - node->offset + size <= node->size;
+}
+
+} // namespace
+
+TlsfAllocator tlsf_allocator(uint32_t memory_type_index, uint64_t block_size, uint64_t buffer_image_granularity) {
+    TlsfAllocator allocator{};
+    allocator.memory_type_index        = memory_type_index;
+    allocator.block_size               = block_size;
+    allocator.buffer_image_granularity = buffer_image_granularity == 0 ? 1 : buffer_image_granularity;
+    allocator.free_heads.fill(tlsf_null_index);
+
+    return allocator;
+}
+
+void tlsf_add_memory_block(TlsfAllocator* allocator, VkDeviceMemory memory, uint64_t size) {
+    uint32_t block_index = tlsf_null_index;
+    for (uint32_t i = 0; i < allocator->blocks.size(); i++) {
+        if (allocator->blocks[i].memory == VK_NULL_HANDLE) {
+            block_index = i;
+            break;
+        }
+    }
+    if (block_index == tlsf_null_index) {
+        allocator->blocks.emplace_back();
+        block_index = static_cast<uint32_t>(allocator->blocks.size() - 1);
+    }
+    TlsfMemoryBlock* block  = &allocator->blocks[block_index];
+    block->memory           = memory;
+    block->size             = size;
+    block->allocation_count = 0;
+
+    const uint32_t node_index = acquire_node(allocator);
+    TlsfNode*      node       = &allocator->nodes[node_index];
+    node->offset              = 0;
+    node->size                = size;
+    node->block               = block_index;
+    insert_free_node(allocator, node_index);
+}
+
+VkResult tlsf_allocate(TlsfAllocator* allocator, const VkMemoryRequirements* requirements, ResourceTiling tiling, TlsfAllocation* allocation) {
+    if ((requirements->memoryTypeBits & (1u << allocator->memory_type_index)) == 0) {
+        return VK_ERROR_FEATURE_NOT_PRESENT;
+    }
+    uint64_t size      = requirements->size == 0 ? 1 : requirements->size;
+    uint64_t alignment = requirements->alignment == 0 ? 1 : requirements->alignment;
+    // keeping optimal resources on whole granularity pages guarantees a page never holds both linear and optimal resources
+    if (tiling == ResourceTiling::Optimal && allocator->buffer_image_granularity > 1) {
+        alignment = std::max(alignment, allocator->buffer_image_granularity);
+        size      = align_up(size, allocator->buffer_image_granularity);
+    }
+
+    // the first bucket for the exact size is usually aligned already, otherwise reserve room for the worst case padding
+    uint32_t fl, sl;
+    mapping_search(size, &fl, &sl);
+    uint32_t node_index = find_free_node(allocator, fl, sl);
+    if (node_index == tlsf_null_index || !node_fits(&allocator->nodes[node_index], size, alignment)) {
+        mapping_search(size + alignment - 1, &fl, &sl);
+        node_index = find_free_node(allocator, fl, sl);
+    }
+    if (node_index == tlsf_null_index) {
+        return VK_ERROR_OUT_OF_DEVICE_MEMORY;
+    }
+    remove_free_node(allocator, node_index);
+
+    const uint64_t node_offset    = allocator->nodes[node_index].offset;
+    const uint64_t aligned_offset = align_up(node_offset, alignment);
+    if (aligned_offset != node_offset) {
+        const uint32_t padding_index        = split_node(allocator, node_index, node_offset, aligned_offset - node_offset, true);
+        allocator->nodes[node_index].offset = aligned_offset;
+        allocator->nodes[node_index].size -= aligned_offset - node_offset;
+        insert_free_node(allocator, padding_index);
+    }
+    const uint64_t remaining_size = allocator->nodes[node_index].size - size;
+    if (remaining_size != 0) {
+        const uint32_t remaining_index    = split_node(allocator, node_index, aligned_offset + size, remaining_size, false);
+        allocator->nodes[node_index].size = size;
+        insert_free_node(allocator, remaining_index);
+    }
+
+    const TlsfNode*  node  = &allocator->nodes[node_index];
+    TlsfMemoryBlock* block = &allocator->blocks[node->block];
+    block->allocation_count++;
+    allocator->allocation_count++;
+    allocator->used_size += size;
+
+    allocation->memory = block->memory;
+    allocation->offset = node->offset;
+    allocation->size   = node->size;
+    allocation->node   = node_index;
+
+    VK_LIB_COUNT(Allocations, 1);
+    return VK_SUCCESS;
+}
+
+void tlsf_free(TlsfAllocator* allocator, const TlsfAllocation* allocation) {
+    if (allocation->node == tlsf_null_index) {
+        return;
+    }
+    uint32_t  node_index = allocation->node;
+    TlsfNode* node       = &allocator->nodes[node_index];
+    allocator->blocks[node->block].allocation_count--;
+    allocator->allocation_count--;
+    allocator->used_size -= node->size;
+
+    const uint32_t prev_index = node->prev_physical;
+    if (prev_index != tlsf_null_index && allocator->nodes[prev_index].free) {
+        remove_free_node(allocator, prev_index);
+        merge_nodes(allocator, prev_index, node_index);
+        node_index = prev_index;
+    }
+    const uint32_t next_index = allocator->nodes[node_index].next_physical;
+    if (next_index != tlsf_null_index && allocator->nodes[next_index].free) {
+        remove_free_node(allocator, next_index);
+        merge_nodes(allocator, node_index, next_index);
+    }
+    insert_free_node(allocator, node_index);
+}
+
+void tlsf_release_empty_blocks(TlsfAllocator* allocator, std::vector<VkDeviceMemory>* released_memory) {
+    for (uint32_t node_index = 0; node_index < allocator->nodes.size(); node_index++) {
+        const TlsfNode* node = &allocator->nodes[node_index];
+        if (!node->free || node->prev_physical != tlsf_null_index || node->next_physical != tlsf_null_index) {
+            continue;
+        }
+        // a free node without physical neighbours spans its whole block
+        TlsfMemoryBlock* block = &allocator->blocks[node->block];
+        released_memory->push_back(block->memory);
+        *block = TlsfMemoryBlock{};
+        remove_free_node(allocator, node_index);
+        release_node(allocator, node_index);
+    }
+}
+
+TlsfStatistics tlsf_statistics(const TlsfAllocator* allocator) {
+    TlsfStatistics statistics{};
+    for (const TlsfMemoryBlock& block : allocator->blocks) {
+        if (block.memory != VK_NULL_HANDLE) {
+            statistics.total_size += block.size;
+            statistics.block_count++;
+        }
+    }
+    statistics.used_size        = allocator->used_size;
+    statistics.free_size        = statistics.total_size - statistics.used_size;
+    statistics.allocation_count = allocator->allocation_count;
+
+    for (uint32_t head_index : allocator->free_heads) {
+        for (uint32_t node_index = head_index; node_index != tlsf_null_index; node_index = allocator->nodes[node_index].next_free) {
+            statistics.largest_free_size = std::max(statistics.largest_free_size, allocator->nodes[node_index].size);
+            statistics.free_range_count++;
+        }
+    }
+    if (statistics.free_size != 0) {
+        statistics.fragmentation = 1.f - static_cast<float>(statistics.largest_free_size) / static_cast<float>(statistics.free_size);
+    }
+
+    return statistics;
+}
+
+} // namespace vk_lib
\ No newline at end of file
@@ -0,0 +1,452 @@
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <vk_lib/counters.h>
+#include <vk_lib/object_caches.h>
+
+namespace vk_lib {
+
+namespace {
+
+// members are appended one at a time, copying whole structures would hash their padding
+template <typename T> void write(ObjectKey* key, const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    const auto* value_bytes = reinterpret_cast<const uint8_t*>(&value);
+    key->bytes.insert(key->bytes.end(), value_bytes, value_bytes + sizeof(T));
+}
+
+void write_bytes(ObjectKey* key, const void* data, size_t size) {
+    write(key, size);
+    const auto* data_bytes = static_cast<const uint8_t*>(data);
+    key->bytes.insert(key->bytes.end(), data_bytes, data_bytes + size);
+}
+
+void write_string(ObjectKey* key, const char* string) { write_bytes(key, string, string != nullptr ? strlen(string) : 0); }
+
+// records whether an optional structure is present, so a missing state never matches an empty one
+bool write_present(ObjectKey* key, const void* state) {
+    write(key, static_cast<uint8_t>(state != nullptr));
+    return state != nullptr;
+}
+
+// FNV-1a, hash continues e.g. the hash of a StaticPipelineState
+void finish_key(ObjectKey* key, uint64_t hash = 14695981039346656037ull) {
+    for (uint8_t byte : key->bytes) {
+        hash = (hash ^ byte) * 1099511628211ull;
+    }
+    key->hash = hash;
+}
+
+bool write_shader_stage(ObjectKey* key, const VkPipelineShaderStageCreateInfo* stage) {
+    if (stage->pNext != nullptr) {
+        return false;
+    }
+    write(key, stage->flags);
+    write(key, stage->stage);
+    write(key, stage->module);
+    write_string(key, stage->pName);
+    if (write_present(key, stage->pSpecializationInfo)) {
+        const VkSpecializationInfo* specialization_info = stage->pSpecializationInfo;
+        write(key, specialization_info->mapEntryCount);
+        for (uint32_t i = 0; i < specialization_info->mapEntryCount; i++) {
+            write(key, specialization_info->pMapEntries[i].constantID);
+            write(key, specialization_info->pMapEntries[i].offset);
+            write(key, specialization_info->pMapEntries[i].size);
+        }
+        write_bytes(key, specialization_info->pData, specialization_info->dataSize);
+    }
+    return true;
+}
+
+void write_stencil_op_state(ObjectKey* key, const VkStencilOpState* state) {
+    write(key, state->failOp);
+    write(key, state->passOp);
+    write(key, state->depthFailOp);
+    write(key, state->compareOp);
+    write(key, state->compareMask);
+    write(key, state->writeMask);
+    write(key, state->reference);
+}
+
+bool write_graphics_pipeline_next(ObjectKey* key, const void* next) {
+    for (const auto* structure = static_cast<const VkBaseInStructure*>(next); structure != nullptr; structure = structure->pNext) {
+        if (structure->sType != VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR) {
+            return false;
+        }
+        const auto* rendering_create_info = reinterpret_cast<const VkPipelineRenderingCreateInfoKHR*>(structure);
+        write(key, rendering_create_info->sType);
+        write(key, rendering_create_info->viewMask);
+        write(key, rendering_create_info->colorAttachmentCount);
+        for (uint32_t i = 0; i < rendering_create_info->colorAttachmentCount; i++) {
+            write(key, rendering_create_info->pColorAttachmentFormats[i]);
+        }
+        write(key, rendering_create_info->depthAttachmentFormat);
+        write(key, rendering_create_info->stencilAttachmentFormat);
+    }
+    return true;
+}
+
+bool is_dynamic(const VkGraphicsPipelineCreateInfo* create_info, VkDynamicState state) {
+    if (create_info->pDynamicState == nullptr) {
+        return false;
+    }
+    const VkDynamicState* begin = create_info->pDynamicState->pDynamicStates;
+    const VkDynamicState* end   = begin + create_info->pDynamicState->dynamicStateCount;
+    return std::find(begin, end, state) != end;
+}
+
+// create MUST create a single object from create_info
+template <typename Handle, typename CreateInfo, typename MakeKey, typename Create>
+VkResult get_or_create(ObjectCache<Handle>* cache, MakeKey make_key, const CreateInfo* create_info, Handle* handle, Create create) {
+    ObjectKey key{};
+    if (!make_key(create_info, &key)) {
+        VK_LIB_COUNT(ObjectCreations, 1);
+        VkResult result = create();
+        if (result == VK_SUCCESS) {
+            cache->uncached.push_back(*handle);
+        }
+        return result;
+    }
+    if ((*handle = object_cache_find(cache, &key)) != VK_NULL_HANDLE) {
+        return VK_SUCCESS;
+    }
+    VK_LIB_COUNT(ObjectCreations, 1);
+    VkResult result = create();
+    if (result == VK_SUCCESS) {
+        object_cache_insert(cache, std::move(key), *handle);
+    }
+    return result;
+}
+
+// writes what both graphics pipeline keys compare by content: the pNext chain, layout, render pass, shader stages and vertex input
+bool write_graphics_pipeline_program(ObjectKey* key, const VkGraphicsPipelineCreateInfo* create_info, bool* has_tessellation) {
+    if (!write_graphics_pipeline_next(key, create_info->pNext)) {
+        return false;
+    }
+    write(key, create_info->flags);
+    write(key, create_info->layout);
+    write(key, create_info->renderPass);
+    write(key, create_info->subpass);
+    if (create_info->flags & VK_PIPELINE_CREATE_DERIVATIVE_BIT) {
+        write(key, create_info->basePipelineHandle);
+        write(key, create_info->basePipelineIndex);
+    }
+
+    write(key, create_info->stageCount);
+    for (uint32_t i = 0; i < create_info->stageCount; i++) {
+        if (!write_shader_stage(key, &create_info->pStages[i])) {
+            return false;
+        }
+        *has_tessellation |= create_info->pStages[i].stage == VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT;
+    }
+
+    if (write_present(key, create_info->pVertexInputState)) {
+        const VkPipelineVertexInputStateCreateInfo* state = create_info->pVertexInputState;
+        if (state->pNext != nullptr) {
+            return false;
+        }
+        write(key, state->flags);
+        write(key, state->vertexBindingDescriptionCount);
+        for (uint32_t i = 0; i < state->vertexBindingDescriptionCount; i++) {
+            write(key, state->pVertexBindingDescriptions[i].binding);
+            write(key, state->pVertexBindingDescriptions[i].stride);
+            write(key, state->pVertexBindingDescriptions[i].inputRate);
+        }
+        write(key, state->vertexAttributeDescriptionCount);
+        for (uint32_t i = 0; i < state->vertexAttributeDescriptionCount; i++) {
+            write(key, state->pVertexAttributeDescriptions[i].location);
+            write(key, state->pVertexAttributeDescriptions[i].binding);
+            write(key, state->pVertexAttributeDescriptions[i].format);
+            write(key, state->pVertexAttributeDescriptions[i].offset);
+        }
+    }
+
+    return true;
+}
+
+} // namespace
+
+bool graphics_pipeline_key(const VkGraphicsPipelineCreateInfo* create_info, ObjectKey* key) {
+    key->bytes.clear();
+    bool has_tessellation = false;
+    if (!write_graphics_pipeline_program(key, create_info, &has_tessellation)) {
+        return false;
+    }
+
+    if (write_present(key, create_info->pInputAssemblyState)) {
+        const VkPipelineInputAssemblyStateCreateInfo* state = create_info->pInputAssemblyState;
+        if (state->pNext != nullptr) {
+            return false;
+        }
+        write(key, state->flags);
+        write(key, state->topology);
+        write(key, state->primitiveRestartEnable);
+    }
+
+    // the tessellation state is ignored, and may be garbage, without tessellation shaders
+    if (has_tessellation && write_present(key, create_info->pTessellationState)) {
+        const VkPipelineTessellationStateCreateInfo* state = create_info->pTessellationState;
+        if (state->pNext != nullptr) {
+            return false;
+        }
+        write(key, state->flags);
+        write(key, state->patchControlPoints);
+    }
+
+    if (write_present(key, create_info->pRasterizationState)) {
+        const VkPipelineRasterizationStateCreateInfo* state = create_info->pRasterizationState;
+        if (state->pNext != nullptr) {
+            return false;
+        }
+        write(key, state->flags);
+        write(key, state->depthClampEnable);
+        write(key, state->rasterizerDiscardEnable);
+        write(key, state->polygonMode);
+        write(key, state->cullMode);
+        write(key, state->frontFace);
+        write(key, state->depthBiasEnable);
+        write(key, state->depthBiasConstantFactor);
+        write(key, state->depthBiasClamp);
+        write(key, state->depthBiasSlopeFactor);
+        write(key, state->lineWidth);
+    }
+
+    if (write_present(key, create_info->pViewportState)) {
+        const VkPipelineViewportStateCreateInfo* state = create_info->pViewportState;
+        if (state->pNext != nullptr) {
+            return false;
+        }
+        write(key, state->flags);
+        if (!is_dynamic(create_info, VK_DYNAMIC_STATE_VIEWPORT_WITH_COUNT)) {
+            write(key, state->viewportCount);
+            for (uint32_t i = 0; i < state->viewportCount && !is_dynamic(create_info, VK_DYNAMIC_STATE_VIEWPORT); i++) {
+                write(key, state->pViewports[i].x);
+                write(key, state->pViewports[i].y);
+                write(key, state->pViewports[i].width);
+                write(key, state->pViewports[i].height);
+                write(key, state->pViewports[i].minDepth);
+                write(key, state->pViewports[i].maxDepth);
+            }
+        }
+        if (!is_dynamic(create_info, VK_DYNAMIC_STATE_SCISSOR_WITH_COUNT)) {
+            write(key, state->scissorCount);
+            for (uint32_t i = 0; i < state->scissorCount && !is_dynamic(create_info, VK_DYNAMIC_STATE_SCISSOR); i++) {
+                write(key, state->pScissors[i].offset.x);
+                write(key, state->pScissors[i].offset.y);
+                write(key, state->pScissors[i].extent.width);
+                write(key, state->pScissors[i].extent.height);
+            }
+        }
+    }
+
+    if (write_present(key, create_info->pMultisampleState)) {
+        const VkPipelineMultisampleStateCreateInfo* state = create_info->pMultisampleState;
+        if (state->pNext != nullptr) {
+            return false;
+        }
+        write(key, state->flags);
+        write(key, state->rasterizationSamples);
+        write(key, state->sampleShadingEnable);
+        write(key, state->minSampleShading);
+        if (write_present(key, state->pSampleMask)) {
+            for (uint32_t i = 0; i < (static_cast<uint32_t>(state->rasterizationSamples) + 31) / 32; i++) {
+                write(key, state->pSampleMask[i]);
+            }
+        }
+        write(key, state->alphaToCoverageEnable);
+        write(key, state->alphaToOneEnable);
+    }
+
+    if (write_present(key, create_info->pDepthStencilState)) {
+        const VkPipelineDepthStencilStateCreateInfo* state = create_info->pDepthStencilState;
+        if (state->pNext != nullptr) {
+            return false;
+        }
+        write(key, state->flags);
+        write(key, state->depthTestEnable);
+        write(key, state->depthWriteEnable);
+        write(key, state->depthCompareOp);
+        write(key, state->depthBoundsTestEnable);
+        write(key, state->stencilTestEnable);
+        write_stencil_op_state(key, &state->front);
+        write_stencil_op_state(key, &state->back);
+        write(key, state->minDepthBounds);
+        write(key, state->maxDepthBounds);
+    }
+
+    if (write_present(key, create_info->pColorBlendState)) {
+        const VkPipelineColorBlendStateCreateInfo* state = create_info->pColorBlendState;
+        if (state->pNext != nullptr) {
+            return false;
+        }
+        write(key, state->flags);
+        write(key, state->logicOpEnable);
+        write(key, state->logicOp);
+        write(key, state->attachmentCount);
+        for (uint32_t i = 0; i < state->attachmentCount; i++) {
+            const VkPipelineColorBlendAttachmentState* attachment = &state->pAttachments[i];
+            write(key, attachment->blendEnable);
+            write(key, attachment->srcColorBlendFactor);
+            write(key, attachment->dstColorBlendFactor);
+            write(key, attachment->colorBlendOp);
+            write(key, attachment->srcAlphaBlendFactor);
+            write(key, attachment->dstAlphaBlendFactor);
+            write(key, attachment->alphaBlendOp);
+            write(key, attachment->colorWriteMask);
+        }
+        for (float blend_constant : state->blendConstants) {
+            write(key, blend_constant);
+        }
+    }
+
+    if (write_present(key, create_info->pDynamicState)) {
+        const VkPipelineDynamicStateCreateInfo* state = create_info->pDynamicState;
+        if (state->pNext != nullptr) {
+            return false;
+        }
+        write(key, state->flags);
+        write(key, state->dynamicStateCount);
+        for (uint32_t i = 0; i < state->dynamicStateCount; i++) {
+            write(key, state->pDynamicStates[i]);
+        }
+    }
+
+    finish_key(key);
+    return true;
+}
+
+bool static_graphics_pipeline_key(const VkGraphicsPipelineCreateInfo* create_info, uint64_t state_hash, ObjectKey* key) {
+    key->bytes.clear();
+    bool has_tessellation = false;
+    if (!write_graphics_pipeline_program(key, create_info, &has_tessellation)) {
+        return false;
+    }
+    write(key, create_info->pInputAssemblyState);
+    write(key, has_tessellation ? create_info->pTessellationState : nullptr);
+    write(key, create_info->pViewportState);
+    write(key, create_info->pRasterizationState);
+    write(key, create_info->pMultisampleState);
+    write(key, create_info->pDepthStencilState);
+    write(key, create_info->pColorBlendState);
+    write(key, create_info->pDynamicState);
+
+    finish_key(key, state_hash);
+    return true;
+}
+
+bool compute_pipeline_key(const VkComputePipelineCreateInfo* create_info, ObjectKey* key) {
+    key->bytes.clear();
+    if (create_info->pNext != nullptr || !write_shader_stage(key, &create_info->stage)) {
+        return false;
+    }
+    write(key, create_info->flags);
+    write(key, create_info->layout);
+    if (create_info->flags & VK_PIPELINE_CREATE_DERIVATIVE_BIT) {
+        write(key, create_info->basePipelineHandle);
+        write(key, create_info->basePipelineIndex);
+    }
+
+    finish_key(key);
+    return true;
+}
+
+bool descriptor_set_layout_key(const VkDescriptorSetLayoutCreateInfo* create_info, ObjectKey* key) {
+    key->bytes.clear();
+    const VkDescriptorBindingFlags* binding_flags = nullptr;
+    for (const auto* structure = static_cast<const VkBaseInStructure*>(create_info->pNext); structure != nullptr; structure = structure->pNext) {
+        if (structure->sType != VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO) {
+            return false;
+        }
+        const auto* binding_flags_create_info = reinterpret_cast<const VkDescriptorSetLayoutBindingFlagsCreateInfo*>(structure);
+        if (binding_flags_create_info->bindingCount != 0) {
+            binding_flags = binding_flags_create_info->pBindingFlags;
+        }
+    }
+    write(key, create_info->flags);
+    write(key, create_info->bindingCount);
+
+    std::vector<uint32_t> binding_order(create_info->bindingCount);
+    for (uint32_t i = 0; i < create_info->bindingCount; i++) {
+        binding_order[i] = i;
+    }
+    std::sort(binding_order.begin(), binding_order.end(),
+              [create_info](uint32_t a, uint32_t b) { return create_info->pBindings[a].binding < create_info->pBindings[b].binding; });
+
+    for (uint32_t i : binding_order) {
+        const VkDescriptorSetLayoutBinding* binding = &create_info->pBindings[i];
+        write(key, binding->binding);
+        write(key, binding->descriptorType);
+        write(key, binding->descriptorCount);
+        write(key, binding->stageFlags);
+        write(key, binding_flags != nullptr ? binding_flags[i] : VkDescriptorBindingFlags{});
+        // immutable samplers are ignored for other descriptor types
+        bool has_samplers =
+            binding->descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER || binding->descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        if (write_present(key, has_samplers ? binding->pImmutableSamplers : nullptr)) {
+            for (uint32_t j = 0; j < binding->descriptorCount; j++) {
+                write(key, binding->pImmutableSamplers[j]);
+            }
+        }
+    }
+
+    finish_key(key);
+    return true;
+}
+
+bool pipeline_layout_key(const VkPipelineLayoutCreateInfo* create_info, ObjectKey* key) {
+    key->bytes.clear();
+    if (create_info->pNext != nullptr) {
+        return false;
+    }
+    write(key, create_info->flags);
+    write(key, create_info->setLayoutCount);
+    for (uint32_t i = 0; i < create_info->setLayoutCount; i++) {
+        write(key, create_info->pSetLayouts[i]);
+    }
+    write(key, create_info->pushConstantRangeCount);
+    for (uint32_t i = 0; i < create_info->pushConstantRangeCount; i++) {
+        write(key, create_info->pPushConstantRanges[i].stageFlags);
+        write(key, create_info->pPushConstantRanges[i].offset);
+        write(key, create_info->pPushConstantRanges[i].size);
+    }
+
+    finish_key(key);
+    return true;
+}
+
+VkResult object_cache_get_graphics_pipeline(PipelineObjectCache* cache, PFN_vkCreateGraphicsPipelines create_graphics_pipelines, VkDevice device,
+                                            VkPipelineCache pipeline_cache, const VkGraphicsPipelineCreateInfo* create_info, VkPipeline* pipeline) {
+    return get_or_create(cache, graphics_pipeline_key, create_info, pipeline,
+                         [&] { return create_graphics_pipelines(device, pipeline_cache, 1, create_info, nullptr, pipeline); });
+}
+
+VkResult object_cache_get_static_graphics_pipeline(PipelineObjectCache* cache, PFN_vkCreateGraphicsPipelines create_graphics_pipelines,
+                                                   VkDevice device, VkPipelineCache pipeline_cache, const VkGraphicsPipelineCreateInfo* create_info,
+                                                   uint64_t state_hash, VkPipeline* pipeline) {
+    const auto make_key = [state_hash](const VkGraphicsPipelineCreateInfo* create_info, ObjectKey* key) {
+        return static_graphics_pipeline_key(create_info, state_hash, key);
+    };
+    return get_or_create(cache, make_key, create_info, pipeline,
+                         [&] { return create_graphics_pipelines(device, pipeline_cache, 1, create_info, nullptr, pipeline); });
+}
+
+VkResult object_cache_get_compute_pipeline(PipelineObjectCache* cache, PFN_vkCreateComputePipelines create_compute_pipelines, VkDevice device,
+                                           VkPipelineCache pipeline_cache, const VkComputePipelineCreateInfo* create_info, VkPipeline* pipeline) {
+    return get_or_create(cache, compute_pipeline_key, create_info, pipeline,
+                         [&] { return create_compute_pipelines(device, pipeline_cache, 1, create_info, nullptr, pipeline); });
+}
+
+VkResult object_cache_get_descriptor_set_layout(DescriptorSetLayoutObjectCache* cache, PFN_vkCreateDescriptorSetLayout create_descriptor_set_layout,
+                                                VkDevice device, const VkDescriptorSetLayoutCreateInfo* create_info,
+                                                VkDescriptorSetLayout* set_layout) {
+    return get_or_create(cache, descriptor_set_layout_key, create_info, set_layout,
+                         [&] { return create_descriptor_set_layout(device, create_info, nullptr, set_layout); });
+}
+
+VkResult object_cache_get_pipeline_layout(PipelineLayoutObjectCache* cache, PFN_vkCreatePipelineLayout create_pipeline_layout, VkDevice device,
+                                          const VkPipelineLayoutCreateInfo* create_info, VkPipelineLayout* layout) {
+    return get_or_create(cache, pipeline_layout_key, create_info, layout,
+                         [&] { return create_pipeline_layout(device, create_info, nullptr, layout); });
+}
+
+} // namespace vk_lib
\ No newline at end of file
@@ -0,0 +1,158 @@
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vk_lib/pipeline_cache.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace vk_lib {
+
+namespace {
+
+#ifdef _WIN32
+
+bool map_file(const char* path, void** mapping, size_t* mapping_size) {
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER file_size{};
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE file_mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (file_mapping == nullptr) {
+        return false;
+    }
+    *mapping = MapViewOfFile(file_mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(file_mapping);
+    *mapping_size = file_size.QuadPart;
+    return *mapping != nullptr;
+}
+
+void unmap_file(void* mapping, size_t) { UnmapViewOfFile(mapping); }
+
+bool write_file(const char* path, std::span<const uint8_t> data) {
+    HANDLE file = CreateFileA(path, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    DWORD      written = 0;
+    const bool success = WriteFile(file, data.data(), static_cast<DWORD>(data.size()), &written, nullptr) && written == data.size() &&
+                         FlushFileBuffers(file);
+    CloseHandle(file);
+    return success;
+}
+
+bool replace_file(const char* src_path, const char* dst_path) {
+    return MoveFileExA(src_path, dst_path, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+}
+
+#else
+
+bool map_file(const char* path, void** mapping, size_t* mapping_size) {
+    const int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat file_stat {};
+    if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0) {
+        close(fd);
+        return false;
+    }
+    void* file_mapping = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (file_mapping == MAP_FAILED) {
+        return false;
+    }
+    *mapping      = file_mapping;
+    *mapping_size = file_stat.st_size;
+    return true;
+}
+
+void unmap_file(void* mapping, size_t mapping_size) { munmap(mapping, mapping_size); }
+
+bool write_file(const char* path, std::span<const uint8_t> data) {
+    const int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    size_t written = 0;
+    while (written < data.size()) {
+        const ssize_t result = write(fd, data.data() + written, data.size() - written);
+        if (result < 0) {
+            close(fd);
+            return false;
+        }
+        written += result;
+    }
+    // the data has to reach the disk before the rename makes it visible
+    const bool success = fsync(fd) == 0;
+    return close(fd) == 0 && success;
+}
+
+bool replace_file(const char* src_path, const char* dst_path) { return rename(src_path, dst_path) == 0; }
+
+#endif
+
+} // namespace
+
+bool pipeline_cache_data_compatible(std::span<const uint8_t> data, const VkPhysicalDeviceProperties* properties) {
+    VkPipelineCacheHeaderVersionOne header{};
+    if (data.size() < sizeof(header)) {
+        return false;
+    }
+    std::memcpy(&header, data.data(), sizeof(header));
+
+    return header.headerSize >= sizeof(header) && header.headerSize <= data.size() && header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+           header.vendorID == properties->vendorID && header.deviceID == properties->deviceID &&
+           std::memcmp(header.pipelineCacheUUID, properties->pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
+VkResult pipeline_cache_file_open(const char* path, const VkPhysicalDeviceProperties* properties, PipelineCacheFile* cache_file) {
+    *cache_file = {};
+    if (!map_file(path, &cache_file->mapping, &cache_file->mapping_size)) {
+        return VK_INCOMPLETE;
+    }
+    const std::span<const uint8_t> data{static_cast<const uint8_t*>(cache_file->mapping), cache_file->mapping_size};
+    if (!pipeline_cache_data_compatible(data, properties)) {
+        pipeline_cache_file_close(cache_file);
+        return VK_INCOMPLETE;
+    }
+    cache_file->data = data;
+
+    return VK_SUCCESS;
+}
+
+void pipeline_cache_file_close(PipelineCacheFile* cache_file) {
+    if (cache_file->mapping != nullptr) {
+        unmap_file(cache_file->mapping, cache_file->mapping_size);
+    }
+    *cache_file = {};
+}
+
+VkResult pipeline_cache_file_write(const char* path, std::span<const uint8_t> data, const VkPhysicalDeviceProperties* properties) {
+    if (!pipeline_cache_data_compatible(data, properties)) {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+    const std::string temporary_path = std::string(path) + ".tmp";
+    if (!write_file(temporary_path.c_str(), data) || !replace_file(temporary_path.c_str(), path)) {
+        std::remove(temporary_path.c_str());
+        return VK_ERROR_UNKNOWN;
+    }
+
+    return VK_SUCCESS;
+}
+
+} // namespace vk_lib
\ No newline at end of file
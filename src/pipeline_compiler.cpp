@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vk_lib/counters.h>
+#include <vk_lib/pipeline_compiler.h>
+
+namespace vk_lib {
+
+namespace {
+
+struct PipelineBatch {
+    std::atomic<uint32_t>         remaining_jobs{};
+    std::atomic<VkResult>         result{VK_SUCCESS};
+    std::promise<VkResult>        promise{};
+    std::function<void(VkResult)> on_complete{};
+};
+
+void worker_loop(PipelineCompiler* compiler) {
+    while (true) {
+        std::function<void()> job;
+        {
+            std::unique_lock lock(compiler->mutex);
+            compiler->condition.wait(lock, [compiler] { return compiler->stopping || !compiler->jobs.empty(); });
+            if (compiler->jobs.empty()) {
+                return;
+            }
+            job = std::move(compiler->jobs.front());
+            compiler->jobs.pop_front();
+        }
+        job();
+    }
+}
+
+template <typename CreateInfo, typename CreatePipelines>
+std::future<VkResult> create_pipelines(PipelineCompiler* compiler, CreatePipelines create_pipelines, VkDevice device, VkPipelineCache pipeline_cache,
+                                       std::span<const CreateInfo> create_infos, std::span<VkPipeline> pipelines,
+                                       std::function<void(VkResult)> on_complete, uint32_t batch_size) {
+    auto                  batch  = std::make_shared<PipelineBatch>();
+    std::future<VkResult> future = batch->promise.get_future();
+    batch->on_complete           = std::move(on_complete);
+    if (create_infos.empty()) {
+        batch->promise.set_value(VK_SUCCESS);
+        if (batch->on_complete) {
+            batch->on_complete(VK_SUCCESS);
+        }
+        return future;
+    }
+
+    if (batch_size == 0) {
+        const size_t worker_count = std::max<size_t>(compiler->workers.size(), 1);
+        batch_size                = std::max<size_t>((create_infos.size() + worker_count * 4 - 1) / (worker_count * 4), 1);
+    }
+    const uint32_t job_count = (create_infos.size() + batch_size - 1) / batch_size;
+    batch->remaining_jobs    = job_count;
+
+    std::unique_lock lock(compiler->mutex);
+    for (uint32_t i = 0; i < job_count; i++) {
+        const size_t offset = static_cast<size_t>(i) * batch_size;
+        const size_t count  = std::min<size_t>(batch_size, create_infos.size() - offset);
+        compiler->jobs.emplace_back([=] {
+            VK_LIB_COUNT(ObjectCreations, count);
+            const VkResult result = create_pipelines(device, pipeline_cache, count, create_infos.data() + offset, nullptr, pipelines.data() + offset);
+            if (result != VK_SUCCESS) {
+                VkResult expected = VK_SUCCESS;
+                batch->result.compare_exchange_strong(expected, result);
+            }
+            if (--batch->remaining_jobs == 0) {
+                const VkResult batch_result = batch->result;
+                if (batch->on_complete) {
+                    batch->on_complete(batch_result);
+                }
+                batch->promise.set_value(batch_result);
+            }
+        });
+    }
+    lock.unlock();
+    compiler->condition.notify_all();
+
+    return future;
+}
+
+} // namespace
+
+void pipeline_compiler_start(PipelineCompiler* compiler, uint32_t thread_count) {
+    if (thread_count == 0) {
+        thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    compiler->stopping = false;
+    for (uint32_t i = 0; i < thread_count; i++) {
+        compiler->workers.emplace_back(worker_loop, compiler);
+    }
+}
+
+void pipeline_compiler_stop(PipelineCompiler* compiler) {
+    {
+        std::lock_guard lock(compiler->mutex);
+        compiler->stopping = true;
+    }
+    compiler->condition.notify_all();
+    for (std::thread& worker : compiler->workers) {
+        worker.join();
+    }
+    compiler->workers.clear();
+}
+
+std::future<VkResult> pipeline_compiler_create_graphics_pipelines(PipelineCompiler* compiler, PFN_vkCreateGraphicsPipelines create_graphics_pipelines,
+                                                                  VkDevice device, VkPipelineCache pipeline_cache,
+                                                                  std::span<const VkGraphicsPipelineCreateInfo> create_infos,
+                                                                  std::span<VkPipeline> pipelines, std::function<void(VkResult)> on_complete,
+                                                                  uint32_t batch_size) {
+    return create_pipelines(compiler, create_graphics_pipelines, device, pipeline_cache, create_infos, pipelines, std::move(on_complete), batch_size);
+}
+
+std::future<VkResult> pipeline_compiler_create_compute_pipelines(PipelineCompiler* compiler, PFN_vkCreateComputePipelines create_compute_pipelines,
+                                                                 VkDevice device, VkPipelineCache pipeline_cache,
+                                                                 std::span<const VkComputePipelineCreateInfo> create_infos,
+                                                                 std::span<VkPipeline> pipelines, std::function<void(VkResult)> on_complete,
+                                                                 uint32_t batch_size) {
+    return create_pipelines(compiler, create_compute_pipelines, device, pipeline_cache, create_infos, pipelines, std::move(on_complete), batch_size);
+}
+
+} // namespace vk_lib
\ No newline at end of file
@@ -0,0 +1,285 @@
+#include <bit>
+#include <cstdio>
+#include <vk_lib/counters.h>
+#include <vk_lib/queries.h>
+
+namespace vk_lib {
+
+namespace {
+
+void append_json_string(const char* string, std::string* json) {
+    json->push_back('"');
+    for (const char* c = string; *c != '\0'; c++) {
+        switch (*c) {
+        case '"':
+            json->append("\\\"");
+            break;
+        case '\\':
+            json->append("\\\\");
+            break;
+        default:
+            if (static_cast<unsigned char>(*c) < 0x20) {
+                char escaped[8];
+                std::snprintf(escaped, sizeof(escaped), "\\u%04x", *c);
+                json->append(escaped);
+            } else {
+                json->push_back(*c);
+            }
+        }
+    }
+    json->push_back('"');
+}
+
+// every query's values are followed by its availability, queries that are not available yet make the call return VK_NOT_READY
+VkResult get_available_query_results(PFN_vkGetQueryPoolResults get_query_pool_results, VkDevice device, VkQueryPool query_pool, uint32_t query_count,
+                                     uint32_t values_per_query, std::vector<uint64_t>* query_data) {
+    const uint32_t stride = values_per_query + 1;
+    query_data->resize(query_count * stride);
+    const VkResult result = get_query_pool_results(device, query_pool, 0, query_count, query_data->size() * sizeof(uint64_t), query_data->data(),
+                                                   stride * sizeof(uint64_t), VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+    return result == VK_NOT_READY ? VK_SUCCESS : result;
+}
+
+constexpr uint32_t statistic_count = std::popcount(pass_statistics_flags);
+
+} // namespace
+
+VkResult gpu_profiler_init(GpuProfiler* profiler, PFN_vkCreateQueryPool create_query_pool, VkDevice device, uint32_t frame_count,
+                           uint32_t max_zones_per_frame, float timestamp_period, uint32_t timestamp_valid_bits) {
+    profiler->queries_per_frame = max_zones_per_frame * 2;
+    profiler->timestamp_period  = timestamp_period;
+    profiler->timestamp_mask    = timestamp_valid_bits >= 64 ? UINT64_MAX : (uint64_t{1} << timestamp_valid_bits) - 1;
+    profiler->frame_number      = 0;
+    profiler->frames.resize(frame_count);
+
+    const VkQueryPoolCreateInfo query_pool_ci = query_pool_create_info(VK_QUERY_TYPE_TIMESTAMP, profiler->queries_per_frame);
+    for (GpuProfilerFrame& frame : profiler->frames) {
+        VK_LIB_COUNT(ObjectCreations, 1);
+        const VkResult result = create_query_pool(device, &query_pool_ci, nullptr, &frame.query_pool);
+        if (result != VK_SUCCESS) {
+            return result;
+        }
+    }
+    return VK_SUCCESS;
+}
+
+VkResult gpu_profiler_begin_frame(GpuProfiler* profiler, PFN_vkGetQueryPoolResults get_query_pool_results,
+                                  PFN_vkCmdResetQueryPool cmd_reset_query_pool, VkDevice device, VkCommandBuffer command_buffer,
+                                  uint32_t frame_index) {
+    GpuProfilerFrame* frame = &profiler->frames[frame_index];
+    profiler->frame_index   = frame_index;
+    profiler->open_zones.clear();
+    profiler->results.clear();
+
+    if (frame->used_queries != 0) {
+        const VkResult result =
+            get_available_query_results(get_query_pool_results, device, frame->query_pool, frame->used_queries, 1, &profiler->query_data);
+        if (result != VK_SUCCESS) {
+            return result;
+        }
+
+        const double microseconds_per_tick = profiler->timestamp_period / 1000.0;
+        for (const GpuZone& zone : frame->zones) {
+            const uint64_t* begin = &profiler->query_data[zone.begin_query * 2];
+            const uint64_t* end   = begin + 2;
+            if (begin[1] == 0 || end[1] == 0) {
+                continue;
+            }
+            // the masked difference stays correct when the counter wrapped around in between
+            const uint64_t ticks = (end[0] - begin[0]) & profiler->timestamp_mask;
+
+            GpuZoneResult zone_result{};
+            zone_result.name         = zone.name;
+            zone_result.depth        = zone.depth;
+            zone_result.frame_number = frame->frame_number;
+            zone_result.begin_us     = static_cast<double>(begin[0] & profiler->timestamp_mask) * microseconds_per_tick;
+            zone_result.duration_us  = static_cast<double>(ticks) * microseconds_per_tick;
+            profiler->results.push_back(zone_result);
+        }
+    }
+    // queries start out undefined, so the whole pool is reset and not only what the frame used
+    cmd_reset_query_pool(command_buffer, frame->query_pool, 0, profiler->queries_per_frame);
+
+    frame->zones.clear();
+    frame->used_queries = 0;
+    frame->frame_number = profiler->frame_number++;
+    return VK_SUCCESS;
+}
+
+void gpu_profiler_begin_zone(GpuProfiler* profiler, PFN_vkCmdWriteTimestamp2KHR cmd_write_timestamp_2, VkCommandBuffer command_buffer,
+                             const char* name, VkPipelineStageFlags2 stage_mask) {
+    GpuProfilerFrame* frame = &profiler->frames[profiler->frame_index];
+    if (frame->used_queries + 2 > profiler->queries_per_frame) {
+        profiler->open_zones.push_back(UINT32_MAX);
+        return;
+    }
+    GpuZone zone{};
+    zone.name        = name;
+    zone.begin_query = frame->used_queries;
+    zone.depth       = profiler->open_zones.size();
+    frame->used_queries += 2;
+
+    profiler->open_zones.push_back(frame->zones.size());
+    frame->zones.push_back(zone);
+    cmd_write_timestamp_2(command_buffer, stage_mask, frame->query_pool, zone.begin_query);
+}
+
+void gpu_profiler_end_zone(GpuProfiler* profiler, PFN_vkCmdWriteTimestamp2KHR cmd_write_timestamp_2, VkCommandBuffer command_buffer,
+                           VkPipelineStageFlags2 stage_mask) {
+    const uint32_t zone_index = profiler->open_zones.back();
+    profiler->open_zones.pop_back();
+    if (zone_index == UINT32_MAX) {
+        return;
+    }
+    GpuProfilerFrame* frame = &profiler->frames[profiler->frame_index];
+    cmd_write_timestamp_2(command_buffer, stage_mask, frame->query_pool, frame->zones[zone_index].begin_query + 1);
+}
+
+void gpu_profiler_release_query_pools(GpuProfiler* profiler, std::vector<VkQueryPool>* query_pools) {
+    for (GpuProfilerFrame& frame : profiler->frames) {
+        query_pools->push_back(frame.query_pool);
+    }
+    profiler->frames.clear();
+}
+
+void chrome_trace_json(std::span<const GpuZoneResult> zones, std::string* json) {
+    json->append("{\"traceEvents\":[");
+    for (uint32_t i = 0; i < zones.size(); i++) {
+        char fields[160];
+        std::snprintf(fields, sizeof(fields), ",\"cat\":\"gpu\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":0,\"args\":{\"frame\":%llu}}",
+                      zones[i].begin_us, zones[i].duration_us, static_cast<unsigned long long>(zones[i].frame_number));
+        json->append(i == 0 ? "{\"name\":" : ",{\"name\":");
+        append_json_string(zones[i].name, json);
+        json->append(fields);
+    }
+    json->append("],\"displayTimeUnit\":\"ms\"}");
+}
+
+VkResult pass_queries_init(PassQueries* queries, PFN_vkCreateQueryPool create_query_pool, VkDevice device, uint32_t frame_count,
+                           uint32_t max_scopes_per_frame) {
+    queries->max_scopes_per_frame = max_scopes_per_frame;
+    queries->frame_number         = 0;
+    queries->frames.resize(frame_count);
+
+    const VkQueryPoolCreateInfo statistics_pool_ci =
+        query_pool_create_info(VK_QUERY_TYPE_PIPELINE_STATISTICS, max_scopes_per_frame, pass_statistics_flags);
+    const VkQueryPoolCreateInfo occlusion_pool_ci = query_pool_create_info(VK_QUERY_TYPE_OCCLUSION, max_scopes_per_frame);
+    for (PassQueryFrame& frame : queries->frames) {
+        VK_LIB_COUNT(ObjectCreations, 2);
+        VkResult result = create_query_pool(device, &statistics_pool_ci, nullptr, &frame.statistics_pool);
+        if (result != VK_SUCCESS) {
+            return result;
+        }
+        result = create_query_pool(device, &occlusion_pool_ci, nullptr, &frame.occlusion_pool);
+        if (result != VK_SUCCESS) {
+            return result;
+        }
+    }
+    return VK_SUCCESS;
+}
+
+VkResult pass_queries_begin_frame(PassQueries* queries, PFN_vkGetQueryPoolResults get_query_pool_results,
+                                  PFN_vkCmdResetQueryPool cmd_reset_query_pool, VkDevice device, VkCommandBuffer command_buffer,
+                                  uint32_t frame_index) {
+    PassQueryFrame* frame = &queries->frames[frame_index];
+    queries->frame_index  = frame_index;
+    queries->open_scope   = UINT32_MAX;
+    queries->results.clear();
+
+    for (const PassQueryScope& scope : frame->scopes) {
+        PassQueryResult scope_result{};
+        scope_result.name         = scope.name;
+        scope_result.frame_number = frame->frame_number;
+        queries->results.push_back(scope_result);
+    }
+
+    if (frame->used_statistics_queries != 0) {
+        const VkResult result = get_available_query_results(get_query_pool_results, device, frame->statistics_pool, frame->used_statistics_queries,
+                                                            statistic_count, &queries->query_data);
+        if (result != VK_SUCCESS) {
+            return result;
+        }
+        for (uint32_t i = 0; i < frame->scopes.size(); i++) {
+            const uint32_t query = frame->scopes[i].statistics_query;
+            if (query == UINT32_MAX || queries->query_data[query * (statistic_count + 1) + statistic_count] == 0) {
+                continue;
+            }
+            const uint64_t*     values     = &queries->query_data[query * (statistic_count + 1)];
+            PipelineStatistics* statistics = &queries->results[i].statistics;
+
+            statistics->input_assembly_vertices     = values[0];
+            statistics->vertex_shader_invocations   = values[1];
+            statistics->clipping_invocations        = values[2];
+            statistics->clipping_primitives         = values[3];
+            statistics->fragment_shader_invocations = values[4];
+            statistics->compute_shader_invocations  = values[5];
+            queries->results[i].has_statistics      = true;
+        }
+    }
+
+    if (frame->used_occlusion_queries != 0) {
+        const VkResult result = get_available_query_results(get_query_pool_results, device, frame->occlusion_pool, frame->used_occlusion_queries, 1,
+                                                            &queries->query_data);
+        if (result != VK_SUCCESS) {
+            return result;
+        }
+        for (uint32_t i = 0; i < frame->scopes.size(); i++) {
+            const uint32_t query = frame->scopes[i].occlusion_query;
+            if (query == UINT32_MAX || queries->query_data[query * 2 + 1] == 0) {
+                continue;
+            }
+            queries->results[i].samples_passed = queries->query_data[query * 2];
+            queries->results[i].has_occlusion  = true;
+        }
+    }
+    std::erase_if(queries->results,
+                  [](const PassQueryResult& scope_result) { return !scope_result.has_statistics && !scope_result.has_occlusion; });
+
+    // queries start out undefined, so the whole pools are reset and not only what the frame used
+    cmd_reset_query_pool(command_buffer, frame->statistics_pool, 0, queries->max_scopes_per_frame);
+    cmd_reset_query_pool(command_buffer, frame->occlusion_pool, 0, queries->max_scopes_per_frame);
+
+    frame->scopes.clear();
+    frame->used_statistics_queries = 0;
+    frame->used_occlusion_queries  = 0;
+    frame->frame_number            = queries->frame_number++;
+    return VK_SUCCESS;
+}
+
+void pass_queries_begin_scope(PassQueries* queries, PFN_vkCmdBeginQuery cmd_begin_query, VkCommandBuffer command_buffer, const char* name,
+                              bool pipeline_statistics, bool occlusion, VkQueryControlFlags occlusion_control_flags) {
+    PassQueryFrame* frame = &queries->frames[queries->frame_index];
+    PassQueryScope  scope{name, UINT32_MAX, UINT32_MAX};
+    if (pipeline_statistics && frame->used_statistics_queries < queries->max_scopes_per_frame) {
+        scope.statistics_query = frame->used_statistics_queries++;
+        cmd_begin_query(command_buffer, frame->statistics_pool, scope.statistics_query, 0);
+    }
+    if (occlusion && frame->used_occlusion_queries < queries->max_scopes_per_frame) {
+        scope.occlusion_query = frame->used_occlusion_queries++;
+        cmd_begin_query(command_buffer, frame->occlusion_pool, scope.occlusion_query, occlusion_control_flags);
+    }
+    queries->open_scope = frame->scopes.size();
+    frame->scopes.push_back(scope);
+}
+
+void pass_queries_end_scope(PassQueries* queries, PFN_vkCmdEndQuery cmd_end_query, VkCommandBuffer command_buffer) {
+    PassQueryFrame*       frame = &queries->frames[queries->frame_index];
+    const PassQueryScope& scope = frame->scopes[queries->open_scope];
+    if (scope.occlusion_query != UINT32_MAX) {
+        cmd_end_query(command_buffer, frame->occlusion_pool, scope.occlusion_query);
+    }
+    if (scope.statistics_query != UINT32_MAX) {
+        cmd_end_query(command_buffer, frame->statistics_pool, scope.statistics_query);
+    }
+    queries->open_scope = UINT32_MAX;
+}
+
+void pass_queries_release_query_pools(PassQueries* queries, std::vector<VkQueryPool>* query_pools) {
+    for (PassQueryFrame& frame : queries->frames) {
+        query_pools->push_back(frame.statistics_pool);
+        query_pools->push_back(frame.occlusion_pool);
+    }
+    queries->frames.clear();
+}
+
+} // namespace vk_lib
\ No newline at end of file
@@ -0,0 +1,195 @@
+#include <algorithm>
+#include <vk_lib/commands.h>
+#include <vk_lib/core.h>
+#include <vk_lib/counters.h>
+#include <vk_lib/queues.h>
+#include <vk_lib/synchronization.h>
+
+namespace vk_lib {
+
+namespace {
+
+bool can_merge(const PendingSubmission* previous, const PendingSubmission* submission) {
+    // the earlier waits then also hold back the later command buffers, which only delays work that was queued after them
+    return previous->pNext == nullptr && submission->pNext == nullptr && previous->flags == submission->flags && previous->signal_info_count == 0 &&
+           submission->wait_info_count == 0;
+}
+
+} // namespace
+
+void queue_setup_init(QueueSetup* setup, std::span<const VkQueueFamilyProperties> queue_family_properties, uint32_t graphics_family,
+                      std::array<float, queue_role_count> priorities) {
+    // graphics and compute families can always transfer, so a transfer family is only worth it without either
+    std::array<uint32_t, queue_role_count> role_families{};
+    role_families[static_cast<uint32_t>(QueueRole::Graphics)] = graphics_family;
+    role_families[static_cast<uint32_t>(QueueRole::Compute)] =
+        find_queue_family_index(queue_family_properties, VK_QUEUE_COMPUTE_BIT, VK_QUEUE_GRAPHICS_BIT).value_or(graphics_family);
+    role_families[static_cast<uint32_t>(QueueRole::Transfer)] =
+        find_queue_family_index(queue_family_properties, VK_QUEUE_TRANSFER_BIT, VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)
+            .value_or(role_families[static_cast<uint32_t>(QueueRole::Compute)]);
+
+    setup->queues.clear();
+    setup->queue_create_infos.clear();
+    setup->queue_priorities.clear();
+    // indexed like queue_create_infos
+    std::vector<uint32_t> create_info_families;
+    for (uint32_t role = 0; role < queue_role_count; role++) {
+        const uint32_t family     = role_families[role];
+        auto           family_end = std::find(create_info_families.begin(), create_info_families.end(), family);
+        if (family_end == create_info_families.end()) {
+            create_info_families.push_back(family);
+            setup->queue_priorities.emplace_back();
+            family_end = create_info_families.end() - 1;
+        }
+        std::vector<float>& family_priorities = setup->queue_priorities[family_end - create_info_families.begin()];
+        if (family_priorities.size() < queue_family_properties[family].queueCount) {
+            setup->role_queues[role] = setup->queues.size();
+            setup->queues.push_back({family, static_cast<uint32_t>(family_priorities.size())});
+            family_priorities.push_back(priorities[role]);
+            continue;
+        }
+        // out of queues, share the family's last one and keep the higher priority
+        for (uint32_t i = setup->queues.size(); i-- > 0;) {
+            if (setup->queues[i].family_index == family) {
+                setup->role_queues[role] = i;
+                break;
+            }
+        }
+        family_priorities.back() = std::max(family_priorities.back(), priorities[role]);
+    }
+
+    for (uint32_t i = 0; i < create_info_families.size(); i++) {
+        setup->queue_create_infos.push_back(device_queue_create_info(create_info_families[i], setup->queue_priorities[i]));
+    }
+}
+
+uint32_t queue_setup_family(const QueueSetup* setup, QueueRole role) {
+    return setup->queues[setup->role_queues[static_cast<uint32_t>(role)]].family_index;
+}
+
+void queue_setup_get_queues(const QueueSetup* setup, PFN_vkGetDeviceQueue get_device_queue, VkDevice device, std::vector<VkQueue>* queues) {
+    queues->resize(setup->queues.size());
+    for (uint32_t i = 0; i < setup->queues.size(); i++) {
+        get_device_queue(device, setup->queues[i].family_index, setup->queues[i].queue_index, &(*queues)[i]);
+    }
+}
+
+void submit_batcher_init(SubmitBatcher* batcher, std::span<const VkQueue> queues) {
+    batcher->queue_count = queues.size();
+    batcher->queues      = std::make_unique<SubmitQueue[]>(queues.size());
+    for (uint32_t i = 0; i < queues.size(); i++) {
+        batcher->queues[i].queue = queues[i];
+    }
+}
+
+void submit_batcher_enqueue(SubmitBatcher* batcher, uint32_t queue_index, const VkSubmitInfo2KHR* submit_info) {
+    SubmitQueue*     queue = &batcher->queues[queue_index];
+    std::unique_lock lock(queue->pending_mutex);
+
+    PendingSubmission submission{};
+    submission.flags                      = submit_info->flags;
+    submission.pNext                      = submit_info->pNext;
+    submission.wait_info_offset           = queue->wait_infos.size();
+    submission.wait_info_count            = submit_info->waitSemaphoreInfoCount;
+    submission.command_buffer_info_offset = queue->command_buffer_infos.size();
+    submission.command_buffer_info_count  = submit_info->commandBufferInfoCount;
+    submission.signal_info_offset         = queue->signal_infos.size();
+    submission.signal_info_count          = submit_info->signalSemaphoreInfoCount;
+    queue->submissions.push_back(submission);
+
+    queue->wait_infos.insert(queue->wait_infos.end(), submit_info->pWaitSemaphoreInfos,
+                             submit_info->pWaitSemaphoreInfos + submit_info->waitSemaphoreInfoCount);
+    queue->command_buffer_infos.insert(queue->command_buffer_infos.end(), submit_info->pCommandBufferInfos,
+                                       submit_info->pCommandBufferInfos + submit_info->commandBufferInfoCount);
+    queue->signal_infos.insert(queue->signal_infos.end(), submit_info->pSignalSemaphoreInfos,
+                               submit_info->pSignalSemaphoreInfos + submit_info->signalSemaphoreInfoCount);
+}
+
+VkResult submit_batcher_flush(SubmitBatcher* batcher, PFN_vkQueueSubmit2KHR queue_submit_2, uint32_t queue_index, VkFence fence) {
+    SubmitQueue*                              queue = &batcher->queues[queue_index];
+    std::vector<PendingSubmission>            submissions;
+    std::vector<VkSemaphoreSubmitInfoKHR>     wait_infos;
+    std::vector<VkCommandBufferSubmitInfoKHR> command_buffer_infos;
+    std::vector<VkSemaphoreSubmitInfoKHR>     signal_infos;
+    {
+        std::unique_lock lock(queue->pending_mutex);
+        submissions.swap(queue->submissions);
+        wait_infos.swap(queue->wait_infos);
+        command_buffer_infos.swap(queue->command_buffer_infos);
+        signal_infos.swap(queue->signal_infos);
+    }
+    if (submissions.empty() && fence == nullptr) {
+        return VK_SUCCESS;
+    }
+
+    // every array was appended to in enqueue order, so merged submissions cover consecutive command buffers
+    std::vector<PendingSubmission> merged_submissions;
+    merged_submissions.reserve(submissions.size());
+    for (const PendingSubmission& submission : submissions) {
+        if (!merged_submissions.empty() && can_merge(&merged_submissions.back(), &submission)) {
+            PendingSubmission* previous = &merged_submissions.back();
+            previous->command_buffer_info_count += submission.command_buffer_info_count;
+            previous->signal_info_offset = submission.signal_info_offset;
+            previous->signal_info_count  = submission.signal_info_count;
+            continue;
+        }
+        merged_submissions.push_back(submission);
+    }
+
+    std::vector<VkSubmitInfo2KHR> submit_infos;
+    submit_infos.reserve(merged_submissions.size());
+    for (const PendingSubmission& submission : merged_submissions) {
+        submit_infos.push_back(
+            submit_info_2_batch({command_buffer_infos.data() + submission.command_buffer_info_offset, submission.command_buffer_info_count},
+                                {wait_infos.data() + submission.wait_info_offset, submission.wait_info_count},
+                                {signal_infos.data() + submission.signal_info_offset, submission.signal_info_count}, submission.flags,
+                                submission.pNext));
+    }
+
+    VK_LIB_COUNT(Submits, 1);
+    std::unique_lock lock(queue->submit_mutex);
+    return queue_submit_2(queue->queue, submit_infos.size(), submit_infos.data(), fence);
+}
+
+VkResult async_compute_init(AsyncComputeScheduler* scheduler, PFN_vkCreateSemaphore create_semaphore, VkDevice device, SubmitBatcher* batcher,
+                            uint32_t graphics_queue_index, uint32_t compute_queue_index) {
+    scheduler->batcher                                                    = batcher;
+    scheduler->batcher_queues[static_cast<uint32_t>(QueueRole::Graphics)] = graphics_queue_index;
+    scheduler->batcher_queues[static_cast<uint32_t>(QueueRole::Compute)]  = compute_queue_index;
+    scheduler->timeline_values.fill(0);
+
+    const VkSemaphoreTypeCreateInfoKHR semaphore_type_ci = semaphore_type_create_info(VK_SEMAPHORE_TYPE_TIMELINE);
+    const VkSemaphoreCreateInfo        semaphore_ci      = semaphore_create_info(&semaphore_type_ci);
+    for (QueueRole role : {QueueRole::Graphics, QueueRole::Compute}) {
+        VK_LIB_COUNT(ObjectCreations, 1);
+        const VkResult result = create_semaphore(device, &semaphore_ci, nullptr, &scheduler->timeline_semaphores[static_cast<uint32_t>(role)]);
+        if (result != VK_SUCCESS) {
+            return result;
+        }
+    }
+    return VK_SUCCESS;
+}
+
+uint64_t async_compute_submit(AsyncComputeScheduler* scheduler, QueueRole queue, const VkSubmitInfo2KHR* submit_info,
+                              std::span<const ScheduledWait> waits) {
+    std::vector<VkSemaphoreSubmitInfoKHR> wait_infos(submit_info->pWaitSemaphoreInfos,
+                                                     submit_info->pWaitSemaphoreInfos + submit_info->waitSemaphoreInfoCount);
+    for (const ScheduledWait& wait : waits) {
+        wait_infos.push_back(semaphore_submit_info(scheduler->timeline_semaphores[static_cast<uint32_t>(wait.queue)], wait.stage_mask, wait.value));
+    }
+
+    // the batcher copies the infos, so they only need to live until the submission is enqueued
+    const uint32_t                        role         = static_cast<uint32_t>(queue);
+    const uint64_t                        signal_value = ++scheduler->timeline_values[role];
+    std::vector<VkSemaphoreSubmitInfoKHR> signal_infos(submit_info->pSignalSemaphoreInfos,
+                                                       submit_info->pSignalSemaphoreInfos + submit_info->signalSemaphoreInfoCount);
+    signal_infos.push_back(semaphore_submit_info(scheduler->timeline_semaphores[role], VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, signal_value));
+
+    const VkSubmitInfo2KHR scheduled_submit_info =
+        submit_info_2_batch({submit_info->pCommandBufferInfos, submit_info->commandBufferInfoCount}, wait_infos, signal_infos, submit_info->flags,
+                            submit_info->pNext);
+    submit_batcher_enqueue(scheduler->batcher, scheduler->batcher_queues[role], &scheduled_submit_info);
+    return signal_value;
+}
+
+} // namespace vk_lib
\ No newline at end of file
@@ -0,0 +1,488 @@
+#include <algorithm>
+#include <vk_lib/memory.h>
+#include <vk_lib/render_graph.h>
+#include <vk_lib/rendering.h>
+#include <vk_lib/synchronization.h>
+
+namespace vk_lib {
+
+namespace {
+
+struct ResourceTracking {
+    VkImageLayout         layout{};
+    VkPipelineStageFlags2 write_stage_mask{};
+    VkAccessFlags2        write_access_mask{};
+    VkPipelineStageFlags2 read_stage_mask{};
+    // stages and accesses the last write has already been made visible to
+    VkPipelineStageFlags2 visible_stage_mask{};
+    VkAccessFlags2        visible_access_mask{};
+};
+
+bool reads(ResourceAccess resource_access) { return resource_access != ResourceAccess::Write; }
+
+bool writes(ResourceAccess resource_access) { return resource_access != ResourceAccess::Read; }
+
+void add_barrier(BarrierBatch* batch, const RenderGraphResource* resource, VkImageLayout old_layout, VkImageLayout new_layout,
+                 VkPipelineStageFlags2 src_stage_mask, VkAccessFlags2 src_access_mask, VkPipelineStageFlags2 dst_stage_mask,
+                 VkAccessFlags2 dst_access_mask) {
+    if (resource->type == RenderGraphResourceType::Image) {
+        const VkImageMemoryBarrier2KHR image_barrier = image_memory_barrier_2(resource->image, resource->subresource_range, old_layout, new_layout,
+                                                                              src_stage_mask, dst_stage_mask, src_access_mask, dst_access_mask);
+        barrier_batch_add_image(batch, &image_barrier);
+    } else {
+        const VkBufferMemoryBarrier2KHR buffer_barrier = buffer_memory_barrier_2(resource->buffer, src_stage_mask, dst_stage_mask, src_access_mask,
+                                                                                 dst_access_mask, resource->offset, resource->size);
+        barrier_batch_add_buffer(batch, &buffer_barrier);
+    }
+}
+
+// writes wait for every earlier access, reads wait for the last write unless it is already visible to them
+bool needs_dependency(const ResourceTracking* tracking, const RenderGraphUsage* usage) {
+    if (writes(usage->resource_access)) {
+        return (tracking->write_stage_mask | tracking->read_stage_mask) != 0;
+    }
+    return tracking->write_stage_mask != 0 &&
+           ((usage->stage_mask & ~tracking->visible_stage_mask) != 0 || (usage->access_mask & ~tracking->visible_access_mask) != 0);
+}
+
+void add_usage(RenderGraph* graph, uint32_t pass, const RenderGraphUsage* usage) {
+    for (RenderGraphUsage& pass_usage : graph->passes[pass].usages) {
+        if (pass_usage.resource != usage->resource) {
+            continue;
+        }
+        if (pass_usage.resource_access != usage->resource_access) {
+            pass_usage.resource_access = ResourceAccess::ReadWrite;
+        }
+        pass_usage.layout = usage->layout;
+        pass_usage.stage_mask |= usage->stage_mask;
+        pass_usage.access_mask |= usage->access_mask;
+        return;
+    }
+    graph->passes[pass].usages.push_back(*usage);
+}
+
+// a pass is kept when it has side effects, writes a resource that outlives the graph or produces something a kept pass reads
+std::vector<bool> find_kept_passes(const RenderGraph* graph) {
+    std::vector<std::vector<uint32_t>> producers(graph->passes.size());
+    std::vector<uint32_t>              last_writers(graph->resources.size(), UINT32_MAX);
+    std::vector<bool>                  kept(graph->passes.size());
+    for (uint32_t pass = 0; pass < graph->passes.size(); pass++) {
+        kept[pass] = graph->passes[pass].has_side_effects;
+        for (const RenderGraphUsage& usage : graph->passes[pass].usages) {
+            if (reads(usage.resource_access) && last_writers[usage.resource] != UINT32_MAX) {
+                producers[pass].push_back(last_writers[usage.resource]);
+            }
+            if (writes(usage.resource_access)) {
+                last_writers[usage.resource] = pass;
+                kept[pass]                   = kept[pass] || !graph->resources[usage.resource].transient;
+            }
+        }
+    }
+    // producers are always declared before their consumers
+    for (uint32_t pass = graph->passes.size(); pass-- > 0;) {
+        if (!kept[pass]) {
+            continue;
+        }
+        for (uint32_t producer : producers[pass]) {
+            kept[producer] = true;
+        }
+    }
+    return kept;
+}
+
+// topological order that schedules the pass whose latest dependency ran earliest, giving the GPU work to overlap with
+// every barrier
+std::vector<uint32_t> schedule_passes(const RenderGraph* graph, const std::vector<bool>& kept) {
+    std::vector<std::vector<uint32_t>> dependents(graph->passes.size());
+    std::vector<uint32_t>              dependency_counts(graph->passes.size());
+    std::vector<uint32_t>              last_writers(graph->resources.size(), UINT32_MAX);
+    std::vector<std::vector<uint32_t>> readers(graph->resources.size());
+    for (uint32_t pass = 0; pass < graph->passes.size(); pass++) {
+        if (!kept[pass]) {
+            continue;
+        }
+        for (const RenderGraphUsage& usage : graph->passes[pass].usages) {
+            const uint32_t last_writer = last_writers[usage.resource];
+            if (last_writer != UINT32_MAX) {
+                dependents[last_writer].push_back(pass);
+                dependency_counts[pass]++;
+            }
+            if (!writes(usage.resource_access)) {
+                readers[usage.resource].push_back(pass);
+                continue;
+            }
+            for (uint32_t reader : readers[usage.resource]) {
+                dependents[reader].push_back(pass);
+                dependency_counts[pass]++;
+            }
+            readers[usage.resource].clear();
+            last_writers[usage.resource] = pass;
+        }
+    }
+
+    std::vector<uint32_t> ready_passes;
+    std::vector<int64_t>  latest_dependencies(graph->passes.size(), -1);
+    for (uint32_t pass = 0; pass < graph->passes.size(); pass++) {
+        if (kept[pass] && dependency_counts[pass] == 0) {
+            ready_passes.push_back(pass);
+        }
+    }
+    std::vector<uint32_t> pass_order;
+    while (!ready_passes.empty()) {
+        uint32_t best = 0;
+        for (uint32_t i = 1; i < ready_passes.size(); i++) {
+            const uint32_t pass      = ready_passes[i];
+            const uint32_t best_pass = ready_passes[best];
+            if (latest_dependencies[pass] < latest_dependencies[best_pass] ||
+                (latest_dependencies[pass] == latest_dependencies[best_pass] && pass < best_pass)) {
+                best = i;
+            }
+        }
+        const uint32_t pass = ready_passes[best];
+        ready_passes.erase(ready_passes.begin() + best);
+
+        const int64_t position = pass_order.size();
+        pass_order.push_back(pass);
+        for (uint32_t dependent : dependents[pass]) {
+            latest_dependencies[dependent] = position;
+            if (--dependency_counts[dependent] == 0) {
+                ready_passes.push_back(dependent);
+            }
+        }
+    }
+    return pass_order;
+}
+
+struct Lifetime {
+    uint32_t first_position{UINT32_MAX};
+    uint32_t last_position{};
+};
+
+bool overlaps(const Lifetime* a, const Lifetime* b) { return a->first_position <= b->last_position && b->first_position <= a->last_position; }
+
+bool overlaps(const RenderGraphResource* a, const RenderGraphResource* b) {
+    return a->memory_offset < b->memory_offset + b->memory_requirements.size && b->memory_offset < a->memory_offset + a->memory_requirements.size;
+}
+
+// places the largest images first, each at the lowest offset not used by an image that is live at the same time.
+// returns, for every transient image, the images whose memory it takes over and whose last use it has to wait for
+std::vector<std::vector<uint32_t>> place_transient_images(RenderGraph* graph) {
+    std::vector<Lifetime> lifetimes(graph->resources.size());
+    for (uint32_t position = 0; position < graph->pass_order.size(); position++) {
+        for (const RenderGraphUsage& usage : graph->passes[graph->pass_order[position]].usages) {
+            lifetimes[usage.resource].first_position = std::min(lifetimes[usage.resource].first_position, position);
+            lifetimes[usage.resource].last_position  = position;
+        }
+    }
+
+    std::vector<uint32_t> placement_order;
+    for (uint32_t i = 0; i < graph->resources.size(); i++) {
+        if (!graph->resources[i].transient) {
+            continue;
+        }
+        graph->resources[i].memory_offset = VK_WHOLE_SIZE;
+        if (lifetimes[i].first_position != UINT32_MAX) {
+            placement_order.push_back(i);
+        }
+    }
+    std::stable_sort(placement_order.begin(), placement_order.end(), [graph](uint32_t a, uint32_t b) {
+        return graph->resources[a].memory_requirements.size > graph->resources[b].memory_requirements.size;
+    });
+
+    graph->transient_memory_size      = 0;
+    graph->transient_memory_alignment = 1;
+    graph->transient_memory_type_bits = placement_order.empty() ? 0 : UINT32_MAX;
+    std::vector<const RenderGraphResource*> live_images;
+    for (uint32_t i = 0; i < placement_order.size(); i++) {
+        RenderGraphResource*        resource     = &graph->resources[placement_order[i]];
+        const VkMemoryRequirements* requirements = &resource->memory_requirements;
+        live_images.clear();
+        for (uint32_t j = 0; j < i; j++) {
+            if (overlaps(&lifetimes[placement_order[i]], &lifetimes[placement_order[j]])) {
+                live_images.push_back(&graph->resources[placement_order[j]]);
+            }
+        }
+        std::sort(live_images.begin(), live_images.end(),
+                  [](const RenderGraphResource* a, const RenderGraphResource* b) { return a->memory_offset < b->memory_offset; });
+
+        uint64_t offset = 0;
+        for (const RenderGraphResource* live_image : live_images) {
+            if (offset + requirements->size <= live_image->memory_offset) {
+                break;
+            }
+            const uint64_t live_image_end = live_image->memory_offset + live_image->memory_requirements.size;
+            offset = std::max(offset, (live_image_end + requirements->alignment - 1) / requirements->alignment * requirements->alignment);
+        }
+        resource->memory_offset           = offset;
+        graph->transient_memory_size      = std::max(graph->transient_memory_size, offset + requirements->size);
+        graph->transient_memory_alignment = std::max(graph->transient_memory_alignment, requirements->alignment);
+        graph->transient_memory_type_bits &= requirements->memoryTypeBits;
+    }
+
+    std::vector<std::vector<uint32_t>> aliased_images(graph->resources.size());
+    for (uint32_t a : placement_order) {
+        for (uint32_t b : placement_order) {
+            if (lifetimes[a].last_position < lifetimes[b].first_position && overlaps(&graph->resources[a], &graph->resources[b])) {
+                aliased_images[b].push_back(a);
+            }
+        }
+    }
+    return aliased_images;
+}
+
+} // namespace
+
+uint32_t render_graph_import_image(RenderGraph* graph, VkImage image, VkImageView image_view, VkImageSubresourceRange subresource_range,
+                                   VkImageLayout initial_layout, VkImageLayout final_layout, VkPipelineStageFlags2 initial_stage_mask,
+                                   VkAccessFlags2 initial_access_mask, VkPipelineStageFlags2 final_stage_mask, VkAccessFlags2 final_access_mask) {
+    RenderGraphResource resource{};
+    resource.type                = RenderGraphResourceType::Image;
+    resource.image               = image;
+    resource.image_view          = image_view;
+    resource.subresource_range   = subresource_range;
+    resource.initial_layout      = initial_layout;
+    resource.initial_stage_mask  = initial_stage_mask;
+    resource.initial_access_mask = initial_access_mask;
+    resource.final_layout        = final_layout;
+    resource.final_stage_mask    = final_stage_mask;
+    resource.final_access_mask   = final_access_mask;
+    graph->resources.push_back(resource);
+
+    return graph->resources.size() - 1;
+}
+
+uint32_t render_graph_import_buffer(RenderGraph* graph, VkBuffer buffer, uint64_t offset, uint64_t size, VkPipelineStageFlags2 initial_stage_mask,
+                                    VkAccessFlags2 initial_access_mask, VkPipelineStageFlags2 final_stage_mask, VkAccessFlags2 final_access_mask) {
+    RenderGraphResource resource{};
+    resource.type                = RenderGraphResourceType::Buffer;
+    resource.buffer              = buffer;
+    resource.offset              = offset;
+    resource.size                = size;
+    resource.initial_stage_mask  = initial_stage_mask;
+    resource.initial_access_mask = initial_access_mask;
+    resource.final_stage_mask    = final_stage_mask;
+    resource.final_access_mask   = final_access_mask;
+    graph->resources.push_back(resource);
+
+    return graph->resources.size() - 1;
+}
+
+uint32_t render_graph_add_transient_image(RenderGraph* graph, VkImage image, VkImageView image_view, VkImageSubresourceRange subresource_range,
+                                          const VkMemoryRequirements* memory_requirements) {
+    RenderGraphResource resource{};
+    resource.type                = RenderGraphResourceType::Image;
+    resource.image               = image;
+    resource.image_view          = image_view;
+    resource.subresource_range   = subresource_range;
+    resource.transient           = true;
+    resource.memory_requirements = *memory_requirements;
+    resource.memory_offset       = VK_WHOLE_SIZE;
+    resource.initial_layout      = VK_IMAGE_LAYOUT_UNDEFINED;
+    resource.initial_stage_mask  = VK_PIPELINE_STAGE_2_NONE;
+    resource.initial_access_mask = VK_ACCESS_2_NONE;
+    graph->resources.push_back(resource);
+
+    return graph->resources.size() - 1;
+}
+
+void render_graph_transient_bind_infos(const RenderGraph* graph, VkDeviceMemory memory, uint64_t memory_offset,
+                                       std::vector<VkBindImageMemoryInfo>* bind_infos) {
+    for (const RenderGraphResource& resource : graph->resources) {
+        if (resource.transient && resource.memory_offset != VK_WHOLE_SIZE) {
+            bind_infos->push_back(bind_image_memory_info(resource.image, memory, memory_offset + resource.memory_offset));
+        }
+    }
+}
+
+uint32_t render_graph_add_pass(RenderGraph* graph, const char* name, VkRect2D render_area, bool has_side_effects) {
+    RenderGraphPass pass{};
+    pass.name             = name;
+    pass.render_area      = render_area;
+    pass.has_side_effects = has_side_effects;
+    graph->passes.push_back(pass);
+
+    return graph->passes.size() - 1;
+}
+
+void render_graph_use_image(RenderGraph* graph, uint32_t pass, uint32_t resource, ResourceAccess resource_access, VkImageLayout layout,
+                            VkPipelineStageFlags2 stage_mask, VkAccessFlags2 access_mask) {
+    RenderGraphUsage usage{};
+    usage.resource        = resource;
+    usage.resource_access = resource_access;
+    usage.layout          = layout;
+    usage.stage_mask      = stage_mask;
+    usage.access_mask     = access_mask;
+    add_usage(graph, pass, &usage);
+}
+
+void render_graph_use_buffer(RenderGraph* graph, uint32_t pass, uint32_t resource, ResourceAccess resource_access, VkPipelineStageFlags2 stage_mask,
+                             VkAccessFlags2 access_mask) {
+    RenderGraphUsage usage{};
+    usage.resource        = resource;
+    usage.resource_access = resource_access;
+    usage.stage_mask      = stage_mask;
+    usage.access_mask     = access_mask;
+    add_usage(graph, pass, &usage);
+}
+
+void render_graph_color_attachment(RenderGraph* graph, uint32_t pass, uint32_t resource, VkAttachmentLoadOp load_op, VkAttachmentStoreOp store_op,
+                                   const VkClearValue* clear_value) {
+    const bool           loads           = load_op == VK_ATTACHMENT_LOAD_OP_LOAD;
+    const ResourceAccess resource_access = loads ? ResourceAccess::ReadWrite : ResourceAccess::Write;
+    const VkAccessFlags2 access_mask     = loads ? VK_ACCESS_2_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT
+                                                 : VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT;
+    render_graph_use_image(graph, pass, resource, resource_access, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                           VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT, access_mask);
+
+    const VkImageView image_view = graph->resources[resource].image_view;
+    graph->passes[pass].color_attachments.push_back(
+        rendering_attachment_info(image_view, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, load_op, store_op, clear_value));
+}
+
+void render_graph_depth_attachment(RenderGraph* graph, uint32_t pass, uint32_t resource, VkAttachmentLoadOp load_op, VkAttachmentStoreOp store_op,
+                                   const VkClearValue* clear_value) {
+    const ResourceAccess resource_access = load_op == VK_ATTACHMENT_LOAD_OP_LOAD ? ResourceAccess::ReadWrite : ResourceAccess::Write;
+    render_graph_use_image(graph, pass, resource, resource_access, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+                           VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT,
+                           VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT);
+
+    const VkImageView image_view             = graph->resources[resource].image_view;
+    graph->passes[pass].depth_attachment     = rendering_attachment_info(image_view, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL, load_op,
+                                                                         store_op, clear_value);
+    graph->passes[pass].has_depth_attachment = true;
+}
+
+void render_graph_compile(RenderGraph* graph) {
+    graph->pass_order = schedule_passes(graph, find_kept_passes(graph));
+
+    const std::vector<std::vector<uint32_t>> aliased_images = place_transient_images(graph);
+
+    graph->pass_barriers.resize(graph->passes.size());
+    for (BarrierBatch& batch : graph->pass_barriers) {
+        barrier_batch_clear(&batch);
+    }
+    barrier_batch_clear(&graph->final_barriers);
+
+    // every resource's usages in execution order, so a barrier can cover all of the reads that follow it
+    std::vector<std::vector<const RenderGraphUsage*>> timelines(graph->resources.size());
+    for (uint32_t pass : graph->pass_order) {
+        for (const RenderGraphUsage& usage : graph->passes[pass].usages) {
+            timelines[usage.resource].push_back(&usage);
+        }
+    }
+    std::vector<ResourceTracking> trackings(graph->resources.size());
+    for (uint32_t i = 0; i < graph->resources.size(); i++) {
+        trackings[i].layout            = graph->resources[i].initial_layout;
+        trackings[i].write_stage_mask  = graph->resources[i].initial_stage_mask;
+        trackings[i].write_access_mask = graph->resources[i].initial_access_mask;
+    }
+
+    std::vector<uint32_t> timeline_positions(graph->resources.size());
+    for (uint32_t pass : graph->pass_order) {
+        for (const RenderGraphUsage& usage : graph->passes[pass].usages) {
+            const RenderGraphResource*                  resource = &graph->resources[usage.resource];
+            ResourceTracking*                           tracking = &trackings[usage.resource];
+            const std::vector<const RenderGraphUsage*>& timeline = timelines[usage.resource];
+            const uint32_t                              position = timeline_positions[usage.resource]++;
+            // an image taking over aliased memory waits for every earlier use of that memory to finish
+            if (position == 0) {
+                for (uint32_t aliased_image : aliased_images[usage.resource]) {
+                    tracking->write_stage_mask |= trackings[aliased_image].write_stage_mask | trackings[aliased_image].read_stage_mask;
+                    tracking->write_access_mask |= trackings[aliased_image].write_access_mask;
+                }
+            }
+
+            const bool is_image      = resource->type == RenderGraphResourceType::Image;
+            const bool layout_change = is_image && usage.layout != tracking->layout;
+            const bool needs_barrier = layout_change || needs_dependency(tracking, &usage);
+
+            VkPipelineStageFlags2 dst_stage_mask  = usage.stage_mask;
+            VkAccessFlags2        dst_access_mask = usage.access_mask;
+            if (!writes(usage.resource_access)) {
+                for (uint32_t i = position + 1; i < timeline.size() && timeline[i]->resource_access == ResourceAccess::Read; i++) {
+                    if (is_image && timeline[i]->layout != usage.layout) {
+                        break;
+                    }
+                    dst_stage_mask |= timeline[i]->stage_mask;
+                    dst_access_mask |= timeline[i]->access_mask;
+                }
+            }
+
+            if (needs_barrier) {
+                const VkImageLayout old_layout = usage.resource_access == ResourceAccess::Write ? VK_IMAGE_LAYOUT_UNDEFINED : tracking->layout;
+                // reads only need an execution dependency before being overwritten, only writes are made available
+                const VkPipelineStageFlags2 src_stage_mask =
+                    layout_change || writes(usage.resource_access) ? tracking->write_stage_mask | tracking->read_stage_mask
+                                                                   : tracking->write_stage_mask;
+                add_barrier(&graph->pass_barriers[pass], resource, is_image ? old_layout : VK_IMAGE_LAYOUT_UNDEFINED,
+                            is_image ? usage.layout : VK_IMAGE_LAYOUT_UNDEFINED, src_stage_mask, tracking->write_access_mask, dst_stage_mask,
+                            dst_access_mask);
+            }
+
+            if (writes(usage.resource_access)) {
+                tracking->write_stage_mask    = usage.stage_mask;
+                tracking->write_access_mask   = usage.access_mask;
+                tracking->read_stage_mask     = 0;
+                tracking->visible_stage_mask  = 0;
+                tracking->visible_access_mask = 0;
+            } else if (layout_change) {
+                // the transition behaves like a write that completes before dst_stage_mask
+                tracking->write_stage_mask    = dst_stage_mask;
+                tracking->write_access_mask   = 0;
+                tracking->read_stage_mask     = usage.stage_mask;
+                tracking->visible_stage_mask  = dst_stage_mask;
+                tracking->visible_access_mask = dst_access_mask;
+            } else {
+                tracking->read_stage_mask |= usage.stage_mask;
+                if (needs_barrier) {
+                    tracking->visible_stage_mask |= dst_stage_mask;
+                    tracking->visible_access_mask |= dst_access_mask;
+                }
+            }
+            if (is_image) {
+                tracking->layout = usage.layout;
+            }
+        }
+    }
+
+    for (uint32_t i = 0; i < graph->resources.size(); i++) {
+        const RenderGraphResource* resource = &graph->resources[i];
+        const ResourceTracking*    tracking = &trackings[i];
+        if (resource->transient) {
+            continue;
+        }
+        const bool is_image      = resource->type == RenderGraphResourceType::Image;
+        const bool layout_change = is_image && resource->final_layout != VK_IMAGE_LAYOUT_UNDEFINED && resource->final_layout != tracking->layout;
+        const bool needs_barrier = layout_change || (resource->final_stage_mask != 0 && tracking->write_stage_mask != 0 &&
+                                                     ((resource->final_stage_mask & ~tracking->visible_stage_mask) != 0 ||
+                                                      (resource->final_access_mask & ~tracking->visible_access_mask) != 0));
+        if (!needs_barrier) {
+            continue;
+        }
+        add_barrier(&graph->final_barriers, resource, tracking->layout, layout_change ? resource->final_layout : tracking->layout,
+                    tracking->write_stage_mask | tracking->read_stage_mask, tracking->write_access_mask, resource->final_stage_mask,
+                    resource->final_access_mask);
+    }
+}
+
+VkDependencyInfoKHR render_graph_pass_dependency_info(const RenderGraph* graph, uint32_t pass) {
+    return barrier_batch_dependency_info(&graph->pass_barriers[pass]);
+}
+
+VkDependencyInfoKHR render_graph_final_dependency_info(const RenderGraph* graph) { return barrier_batch_dependency_info(&graph->final_barriers); }
+
+VkRenderingInfoKHR render_graph_rendering_info(const RenderGraph* graph, uint32_t pass) {
+    const RenderGraphPass* render_pass = &graph->passes[pass];
+    return rendering_info(render_pass->render_area, render_pass->color_attachments,
+                          render_pass->has_depth_attachment ? &render_pass->depth_attachment : nullptr);
+}
+
+void render_graph_clear(RenderGraph* graph) {
+    graph->resources.clear();
+    graph->passes.clear();
+    graph->pass_order.clear();
+    graph->pass_barriers.clear();
+    barrier_batch_clear(&graph->final_barriers);
+}
+
+} // namespace vk_lib
\ No newline at end of file
@@ -0,0 +1,248 @@
+#include <cstring>
+#include <vk_lib/commands.h>
+#include <vk_lib/counters.h>
+#include <vk_lib/resources.h>
+#include <vk_lib/synchronization.h>
+#include <vk_lib/transfers.h>
+
+namespace vk_lib {
+
+namespace {
+
+VkImageSubresourceRange subresource_range_of(const VkImageSubresourceLayers* subresource_layers) {
+    return image_subresource_range(subresource_layers->aspectMask, 1, subresource_layers->mipLevel, subresource_layers->layerCount,
+                                   subresource_layers->baseArrayLayer);
+}
+
+bool transitions_subresource_range(std::span<const VkImageMemoryBarrier2KHR> image_barriers, VkImage image,
+                                   const VkImageSubresourceRange* subresource_range) {
+    for (const VkImageMemoryBarrier2KHR& image_barrier : image_barriers) {
+        const VkImageSubresourceRange* range = &image_barrier.subresourceRange;
+        if (image_barrier.image == image && range->aspectMask == subresource_range->aspectMask &&
+            range->baseMipLevel == subresource_range->baseMipLevel && range->baseArrayLayer == subresource_range->baseArrayLayer &&
+            range->layerCount == subresource_range->layerCount) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+StagingRing staging_ring(VkBuffer buffer, void* mapped_data, uint64_t size) {
+    StagingRing staging_ring{};
+    staging_ring.buffer      = buffer;
+    staging_ring.mapped_data = static_cast<uint8_t*>(mapped_data);
+    staging_ring.size        = size;
+
+    return staging_ring;
+}
+
+VkResult staging_ring_allocate(StagingRing* ring, uint64_t size, uint64_t alignment, StagingAllocation* allocation) {
+    if (alignment == 0) {
+        alignment = 1;
+    }
+    // an empty ring starts over at offset 0, so it can always take an allocation of up to its full size
+    if (ring->head == ring->tail && ring->head % ring->size != 0) {
+        const uint64_t restart = (ring->head / ring->size + 1) * ring->size;
+        // frames still in flight allocated nothing since the tail, they move along
+        for (StagingRetirement& retirement : ring->in_flight) {
+            retirement.head = restart;
+        }
+        ring->head = restart;
+        ring->tail = restart;
+    }
+    const uint64_t position       = ring->head % ring->size;
+    uint64_t       aligned_offset = (position + alignment - 1) / alignment * alignment;
+    // an allocation never straddles the end of the buffer, the skipped tail is reclaimed with the rest of the frame
+    if (aligned_offset + size > ring->size) {
+        aligned_offset = 0;
+    }
+    const uint64_t consumed = aligned_offset >= position ? aligned_offset - position + size : ring->size - position + size;
+    if (size > ring->size || ring->head + consumed - ring->tail > ring->size) {
+        return VK_NOT_READY;
+    }
+    ring->head += consumed;
+
+    allocation->data   = ring->mapped_data + aligned_offset;
+    allocation->offset = aligned_offset;
+    allocation->size   = size;
+
+    VK_LIB_COUNT(Allocations, 1);
+    return VK_SUCCESS;
+}
+
+VkResult staging_ring_upload_buffer(StagingRing* ring, VkBuffer dst_buffer, const void* data, uint64_t size, uint64_t dst_offset,
+                                    uint64_t alignment) {
+    StagingAllocation allocation{};
+    const VkResult    result = staging_ring_allocate(ring, size, alignment, &allocation);
+    if (result != VK_SUCCESS) {
+        return result;
+    }
+    std::memcpy(allocation.data, data, size);
+
+    StagingBufferCopies* copies = nullptr;
+    for (StagingBufferCopies& buffer_copies : ring->buffer_copies) {
+        if (buffer_copies.dst_buffer == dst_buffer) {
+            copies = &buffer_copies;
+            break;
+        }
+    }
+    if (copies == nullptr) {
+        copies             = &ring->buffer_copies.emplace_back();
+        copies->dst_buffer = dst_buffer;
+    }
+    if (!copies->regions.empty()) {
+        VkBufferCopy* last = &copies->regions.back();
+        if (last->srcOffset + last->size == allocation.offset && last->dstOffset + last->size == dst_offset) {
+            last->size += size;
+            return VK_SUCCESS;
+        }
+    }
+    copies->regions.push_back(buffer_copy(size, allocation.offset, dst_offset));
+
+    return VK_SUCCESS;
+}
+
+VkResult staging_ring_upload_image(StagingRing* ring, VkImage dst_image, const void* data, uint64_t size, VkImageSubresourceLayers image_subresource,
+                                   VkExtent3D image_extent, VkOffset3D image_offset, uint64_t alignment, VkImageLayout dst_image_layout) {
+    StagingAllocation allocation{};
+    const VkResult    result = staging_ring_allocate(ring, size, alignment, &allocation);
+    if (result != VK_SUCCESS) {
+        return result;
+    }
+    std::memcpy(allocation.data, data, size);
+
+    StagingImageCopies* copies = nullptr;
+    for (StagingImageCopies& image_copies : ring->image_copies) {
+        if (image_copies.dst_image == dst_image && image_copies.dst_image_layout == dst_image_layout) {
+            copies = &image_copies;
+            break;
+        }
+    }
+    if (copies == nullptr) {
+        copies                   = &ring->image_copies.emplace_back();
+        copies->dst_image        = dst_image;
+        copies->dst_image_layout = dst_image_layout;
+    }
+    copies->regions.push_back(buffer_image_copy(image_subresource, image_extent, allocation.offset, image_offset));
+
+    return VK_SUCCESS;
+}
+
+void staging_ring_clear_copies(StagingRing* ring) {
+    ring->buffer_copies.clear();
+    ring->image_copies.clear();
+}
+
+void staging_ring_end_frame(StagingRing* ring, uint64_t retire_value) {
+    if (!ring->in_flight.empty() && ring->in_flight.back().head == ring->head) {
+        return;
+    }
+    StagingRetirement retirement{};
+    retirement.retire_value = retire_value;
+    retirement.head         = ring->head;
+    ring->in_flight.push_back(retirement);
+}
+
+void staging_ring_retire(StagingRing* ring, uint64_t completed_value) {
+    while (!ring->in_flight.empty() && ring->in_flight.front().retire_value <= completed_value) {
+        ring->tail = ring->in_flight.front().head;
+        ring->in_flight.pop_front();
+    }
+}
+
+UploadQueue upload_queue(StagingRing staging_ring, VkSemaphore timeline_semaphore, uint32_t transfer_queue_family, uint32_t dst_queue_family,
+                         uint64_t initial_timeline_value) {
+    UploadQueue upload_queue{};
+    upload_queue.staging_ring          = std::move(staging_ring);
+    upload_queue.timeline_semaphore    = timeline_semaphore;
+    upload_queue.transfer_queue_family = transfer_queue_family;
+    upload_queue.dst_queue_family      = dst_queue_family;
+    upload_queue.timeline_value        = initial_timeline_value;
+
+    return upload_queue;
+}
+
+void upload_queue_build_barriers(UploadQueue* upload_queue, VkPipelineStageFlags2 dst_stage_mask, VkAccessFlags2 dst_access_mask,
+                                 VkImageLayout dst_image_layout) {
+    upload_queue->pre_copy_image_barriers.clear();
+    upload_queue->release_buffer_barriers.clear();
+    upload_queue->release_image_barriers.clear();
+    upload_queue->acquire_buffer_barriers.clear();
+    upload_queue->acquire_image_barriers.clear();
+
+    // with a single queue family the semaphore signal and wait already order and make the copies visible, only the
+    // image layouts need to change. otherwise ownership is released on the transfer queue and acquired on the other
+    const bool     transfer_ownership = upload_queue->transfer_queue_family != upload_queue->dst_queue_family;
+    const uint32_t src_family         = transfer_ownership ? upload_queue->transfer_queue_family : VK_QUEUE_FAMILY_IGNORED;
+    const uint32_t dst_family         = transfer_ownership ? upload_queue->dst_queue_family : VK_QUEUE_FAMILY_IGNORED;
+
+    if (transfer_ownership) {
+        for (const StagingBufferCopies& buffer_copies : upload_queue->staging_ring.buffer_copies) {
+            for (const VkBufferCopy& region : buffer_copies.regions) {
+                upload_queue->release_buffer_barriers.push_back(buffer_memory_barrier_2(
+                    buffer_copies.dst_buffer, VK_PIPELINE_STAGE_2_TRANSFER_BIT_KHR, VK_PIPELINE_STAGE_2_NONE_KHR, VK_ACCESS_2_TRANSFER_WRITE_BIT_KHR,
+                    VK_ACCESS_2_NONE_KHR, region.dstOffset, region.size, src_family, dst_family));
+                upload_queue->acquire_buffer_barriers.push_back(buffer_memory_barrier_2(buffer_copies.dst_buffer, VK_PIPELINE_STAGE_2_NONE_KHR,
+                                                                                        dst_stage_mask, VK_ACCESS_2_NONE_KHR, dst_access_mask,
+                                                                                        region.dstOffset, region.size, src_family, dst_family));
+            }
+        }
+    }
+
+    for (const StagingImageCopies& image_copies : upload_queue->staging_ring.image_copies) {
+        for (const VkBufferImageCopy& region : image_copies.regions) {
+            // regions writing the same subresources share one set of transitions, a second one would start from the wrong layout
+            const VkImageSubresourceRange subresource_range = subresource_range_of(&region.imageSubresource);
+            if (transitions_subresource_range(upload_queue->pre_copy_image_barriers, image_copies.dst_image, &subresource_range)) {
+                continue;
+            }
+            upload_queue->pre_copy_image_barriers.push_back(image_memory_barrier_2(
+                image_copies.dst_image, subresource_range, VK_IMAGE_LAYOUT_UNDEFINED, image_copies.dst_image_layout, VK_PIPELINE_STAGE_2_NONE_KHR,
+                VK_PIPELINE_STAGE_2_TRANSFER_BIT_KHR, VK_ACCESS_2_NONE_KHR, VK_ACCESS_2_TRANSFER_WRITE_BIT_KHR));
+            upload_queue->release_image_barriers.push_back(image_memory_barrier_2(
+                image_copies.dst_image, subresource_range, image_copies.dst_image_layout, dst_image_layout, VK_PIPELINE_STAGE_2_TRANSFER_BIT_KHR,
+                VK_PIPELINE_STAGE_2_NONE_KHR, VK_ACCESS_2_TRANSFER_WRITE_BIT_KHR, VK_ACCESS_2_NONE_KHR, src_family, dst_family));
+            if (transfer_ownership) {
+                upload_queue->acquire_image_barriers.push_back(image_memory_barrier_2(
+                    image_copies.dst_image, subresource_range, image_copies.dst_image_layout, dst_image_layout, VK_PIPELINE_STAGE_2_NONE_KHR,
+                    dst_stage_mask, VK_ACCESS_2_NONE_KHR, dst_access_mask, src_family, dst_family));
+            }
+        }
+    }
+
+    VK_LIB_COUNT(Barriers, upload_queue->pre_copy_image_barriers.size() + upload_queue->release_buffer_barriers.size() +
+                               upload_queue->release_image_barriers.size() + upload_queue->acquire_buffer_barriers.size() +
+                               upload_queue->acquire_image_barriers.size());
+}
+
+VkDependencyInfoKHR upload_queue_pre_copy_dependency_info(const UploadQueue* upload_queue) {
+    return dependency_info_batch(upload_queue->pre_copy_image_barriers, {}, {});
+}
+
+VkDependencyInfoKHR upload_queue_release_dependency_info(const UploadQueue* upload_queue) {
+    return dependency_info_batch(upload_queue->release_image_barriers, upload_queue->release_buffer_barriers, {});
+}
+
+VkDependencyInfoKHR upload_queue_acquire_dependency_info(const UploadQueue* upload_queue) {
+    return dependency_info_batch(upload_queue->acquire_image_barriers, upload_queue->acquire_buffer_barriers, {});
+}
+
+VkSubmitInfo2KHR upload_queue_submit_info(UploadQueue* upload_queue, VkCommandBuffer command_buffer) {
+    upload_queue->timeline_value++;
+    staging_ring_end_frame(&upload_queue->staging_ring, upload_queue->timeline_value);
+    staging_ring_clear_copies(&upload_queue->staging_ring);
+
+    upload_queue->command_buffer_submit_info = command_buffer_submit_info(command_buffer);
+    upload_queue->signal_semaphore_submit_info =
+        semaphore_submit_info(upload_queue->timeline_semaphore, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, upload_queue->timeline_value);
+
+    return submit_info_2_batch({&upload_queue->command_buffer_submit_info, 1}, {}, {&upload_queue->signal_semaphore_submit_info, 1});
+}
+
+VkSemaphoreSubmitInfoKHR upload_queue_wait_semaphore_submit_info(const UploadQueue* upload_queue, VkPipelineStageFlags2 stage_mask) {
+    return semaphore_submit_info(upload_queue->timeline_semaphore, stage_mask, upload_queue->timeline_value);
+}
+
+} // namespace vk_lib
\ No newline at end of file
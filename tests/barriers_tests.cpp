@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include <vk_lib/barriers.h>
+#include <vk_lib/resources.h>
+#include <vk_lib/synchronization.h>
+
+class BarrierBatchTestsFixture : public testing::Test {
+  public:
+    BarrierBatchTestsFixture() {}
+
+    ~BarrierBatchTestsFixture() override {}
+
+  protected:
+    static VkImage  fake_image(uintptr_t id) { return reinterpret_cast<VkImage>(id); }
+    static VkBuffer fake_buffer(uintptr_t id) { return reinterpret_cast<VkBuffer>(id); }
+
+    vk_lib::BarrierBatch    batch{};
+    VkImageSubresourceRange color_range = vk_lib::image_subresource_range(VK_IMAGE_ASPECT_COLOR_BIT);
+};
+
+TEST_F(BarrierBatchTestsFixture, mergesLayoutTransitionsOnSameImage) {
+    VkImageMemoryBarrier2KHR to_transfer =
+        vk_lib::image_memory_barrier_2(fake_image(1), color_range, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                       VK_PIPELINE_STAGE_2_NONE, VK_PIPELINE_STAGE_2_TRANSFER_BIT, VK_ACCESS_2_NONE, VK_ACCESS_2_TRANSFER_WRITE_BIT);
+    VkImageMemoryBarrier2KHR to_shader_read = vk_lib::image_memory_barrier_2(
+        fake_image(1), color_range, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+        VK_PIPELINE_STAGE_2_TRANSFER_BIT, VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT, VK_ACCESS_2_TRANSFER_WRITE_BIT, VK_ACCESS_2_SHADER_READ_BIT);
+    VkImageMemoryBarrier2KHR other_image =
+        vk_lib::image_memory_barrier_2(fake_image(2), color_range, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_GENERAL);
+    vk_lib::barrier_batch_add_image(&batch, &to_transfer);
+    vk_lib::barrier_batch_add_image(&batch, &to_shader_read);
+    vk_lib::barrier_batch_add_image(&batch, &other_image);
+
+    VkDependencyInfoKHR dependency_info = vk_lib::barrier_batch_dependency_info(&batch);
+    ASSERT_EQ(dependency_info.imageMemoryBarrierCount, 2);
+    EXPECT_EQ(dependency_info.pImageMemoryBarriers[0].oldLayout, VK_IMAGE_LAYOUT_UNDEFINED);
+    EXPECT_EQ(dependency_info.pImageMemoryBarriers[0].newLayout, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    EXPECT_EQ(dependency_info.pImageMemoryBarriers[0].dstStageMask, VK_PIPELINE_STAGE_2_TRANSFER_BIT | VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT);
+}
+
+TEST_F(BarrierBatchTestsFixture, dropsReadOnlyBarriers) {
+    VkImageMemoryBarrier2KHR read_after_read = vk_lib::image_memory_barrier_2(
+        fake_image(1), color_range, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+        VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_ACCESS_2_SHADER_READ_BIT, VK_ACCESS_2_SHADER_READ_BIT);
+    VkBufferMemoryBarrier2KHR vertex_read =
+        vk_lib::buffer_memory_barrier_2(fake_buffer(3), VK_PIPELINE_STAGE_2_VERTEX_INPUT_BIT, VK_PIPELINE_STAGE_2_VERTEX_INPUT_BIT,
+                                        VK_ACCESS_2_VERTEX_ATTRIBUTE_READ_BIT, VK_ACCESS_2_VERTEX_ATTRIBUTE_READ_BIT);
+    vk_lib::barrier_batch_add_image(&batch, &read_after_read);
+    vk_lib::barrier_batch_add_buffer(&batch, &vertex_read);
+    EXPECT_TRUE(vk_lib::barrier_batch_empty(&batch));
+
+    VkBufferMemoryBarrier2KHR write_after_read =
+        vk_lib::buffer_memory_barrier_2(fake_buffer(3), VK_PIPELINE_STAGE_2_VERTEX_INPUT_BIT, VK_PIPELINE_STAGE_2_TRANSFER_BIT,
+                                        VK_ACCESS_2_VERTEX_ATTRIBUTE_READ_BIT, VK_ACCESS_2_TRANSFER_WRITE_BIT);
+    vk_lib::barrier_batch_add_buffer(&batch, &write_after_read);
+    vk_lib::barrier_batch_add_buffer(&batch, &write_after_read);
+    EXPECT_EQ(batch.buffer_barriers.size(), 1);
+
+    vk_lib::barrier_batch_clear(&batch);
+    EXPECT_TRUE(vk_lib::barrier_batch_empty(&batch));
+}
+
+TEST_F(BarrierBatchTestsFixture, keepsExecutionOnlyBarriers) {
+    // a transfer overwriting a buffer the vertex shader read only needs the read to finish
+    VkBufferMemoryBarrier2KHR write_after_read = vk_lib::buffer_memory_barrier_2(
+        fake_buffer(1), VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT, VK_PIPELINE_STAGE_2_TRANSFER_BIT, VK_ACCESS_2_NONE, VK_ACCESS_2_NONE);
+    VkMemoryBarrier2KHR execution_only =
+        vk_lib::global_memory_barrier_2(VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_2_TRANSFER_BIT, VK_ACCESS_2_NONE, VK_ACCESS_2_NONE);
+    VkMemoryBarrier2KHR no_stages =
+        vk_lib::global_memory_barrier_2(VK_PIPELINE_STAGE_2_NONE, VK_PIPELINE_STAGE_2_NONE, VK_ACCESS_2_NONE, VK_ACCESS_2_NONE);
+    vk_lib::barrier_batch_add_buffer(&batch, &write_after_read);
+    vk_lib::barrier_batch_add_memory(&batch, &no_stages);
+    EXPECT_EQ(batch.buffer_barriers.size(), 1);
+    EXPECT_TRUE(batch.memory_barriers.empty());
+
+    vk_lib::barrier_batch_add_memory(&batch, &execution_only);
+    EXPECT_EQ(batch.memory_barriers.size(), 1);
+}
+
+TEST_F(BarrierBatchTestsFixture, mergesOnlyChainedLayouts) {
+    VkImageMemoryBarrier2KHR to_transfer =
+        vk_lib::image_memory_barrier_2(fake_image(1), color_range, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    VkImageMemoryBarrier2KHR from_general =
+        vk_lib::image_memory_barrier_2(fake_image(1), color_range, VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    vk_lib::barrier_batch_add_image(&batch, &to_transfer);
+    vk_lib::barrier_batch_add_image(&batch, &from_general);
+
+    ASSERT_EQ(batch.image_barriers.size(), 2);
+    EXPECT_EQ(batch.image_barriers[0].newLayout, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    EXPECT_EQ(batch.image_barriers[1].oldLayout, VK_IMAGE_LAYOUT_GENERAL);
+}
\ No newline at end of file
@@ -0,0 +1,207 @@
+#include <benchmark/benchmark.h>
+#include <vk_lib/commands.h>
+#include <vk_lib/rendering.h>
+#include <vk_lib/resources.h>
+#include <vk_lib/shader_data.h>
+#include <vk_lib/synchronization.h>
+
+// Every builder is measured against the same struct written with designated initializers. The inputs pass through
+// DoNotOptimize() each iteration so neither version is folded into a constant, any gap left is the cost of the builder.
+
+namespace {
+
+template <typename Handle> Handle handle(uintptr_t id) { return reinterpret_cast<Handle>(id); }
+
+void rendering_attachment_info_builder(benchmark::State& state) {
+    VkImageView  image_view = handle<VkImageView>(1);
+    VkClearValue clear_value{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(image_view);
+        VkRenderingAttachmentInfoKHR attachment = vk_lib::rendering_attachment_info(
+            image_view, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, VK_ATTACHMENT_LOAD_OP_CLEAR, VK_ATTACHMENT_STORE_OP_STORE, &clear_value);
+        benchmark::DoNotOptimize(attachment);
+    }
+}
+
+void rendering_attachment_info_designated(benchmark::State& state) {
+    VkImageView  image_view = handle<VkImageView>(1);
+    VkClearValue clear_value{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(image_view);
+        VkRenderingAttachmentInfoKHR attachment{
+            .sType              = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR,
+            .imageView          = image_view,
+            .imageLayout        = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+            .resolveMode        = VK_RESOLVE_MODE_NONE_KHR,
+            .resolveImageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+            .loadOp             = VK_ATTACHMENT_LOAD_OP_CLEAR,
+            .storeOp            = VK_ATTACHMENT_STORE_OP_STORE,
+            .clearValue         = clear_value,
+        };
+        benchmark::DoNotOptimize(attachment);
+    }
+}
+
+void rendering_info_builder(benchmark::State& state) {
+    VkRect2D                                    render_area{{0, 0}, {1920, 1080}};
+    std::array<VkRenderingAttachmentInfoKHR, 2> color_attachments{};
+    VkRenderingAttachmentInfoKHR                depth_attachment{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(render_area);
+        VkRenderingInfoKHR rendering_info = vk_lib::rendering_info(render_area, color_attachments, &depth_attachment);
+        benchmark::DoNotOptimize(rendering_info);
+    }
+}
+
+void rendering_info_designated(benchmark::State& state) {
+    VkRect2D                                    render_area{{0, 0}, {1920, 1080}};
+    std::array<VkRenderingAttachmentInfoKHR, 2> color_attachments{};
+    VkRenderingAttachmentInfoKHR                depth_attachment{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(render_area);
+        VkRenderingInfoKHR rendering_info{
+            .sType                = VK_STRUCTURE_TYPE_RENDERING_INFO_KHR,
+            .renderArea           = render_area,
+            .layerCount           = 1,
+            .colorAttachmentCount = color_attachments.size(),
+            .pColorAttachments    = color_attachments.data(),
+            .pDepthAttachment     = &depth_attachment,
+        };
+        benchmark::DoNotOptimize(rendering_info);
+    }
+}
+
+void submit_info_2_builder(benchmark::State& state) {
+    VkCommandBuffer          command_buffer = handle<VkCommandBuffer>(1);
+    VkSemaphoreSubmitInfoKHR wait_info{};
+    VkSemaphoreSubmitInfoKHR signal_info{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(command_buffer);
+        VkCommandBufferSubmitInfoKHR command_buffer_info = vk_lib::command_buffer_submit_info(command_buffer);
+        VkSubmitInfo2KHR             submit_info         = vk_lib::submit_info_2(&command_buffer_info, &wait_info, &signal_info);
+        benchmark::DoNotOptimize(submit_info);
+    }
+}
+
+void submit_info_2_designated(benchmark::State& state) {
+    VkCommandBuffer          command_buffer = handle<VkCommandBuffer>(1);
+    VkSemaphoreSubmitInfoKHR wait_info{};
+    VkSemaphoreSubmitInfoKHR signal_info{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(command_buffer);
+        VkCommandBufferSubmitInfoKHR command_buffer_info{
+            .sType         = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO_KHR,
+            .commandBuffer = command_buffer,
+        };
+        VkSubmitInfo2KHR submit_info{
+            .sType                    = VK_STRUCTURE_TYPE_SUBMIT_INFO_2_KHR,
+            .waitSemaphoreInfoCount   = 1,
+            .pWaitSemaphoreInfos      = &wait_info,
+            .commandBufferInfoCount   = 1,
+            .pCommandBufferInfos      = &command_buffer_info,
+            .signalSemaphoreInfoCount = 1,
+            .pSignalSemaphoreInfos    = &signal_info,
+        };
+        benchmark::DoNotOptimize(submit_info);
+    }
+}
+
+void image_memory_barrier_2_builder(benchmark::State& state) {
+    VkImage image = handle<VkImage>(1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(image);
+        VkImageMemoryBarrier2KHR barrier =
+            vk_lib::image_memory_barrier_2(image, vk_lib::image_subresource_range(VK_IMAGE_ASPECT_COLOR_BIT), VK_IMAGE_LAYOUT_UNDEFINED,
+                                           VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+        benchmark::DoNotOptimize(barrier);
+    }
+}
+
+void image_memory_barrier_2_designated(benchmark::State& state) {
+    VkImage image = handle<VkImage>(1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(image);
+        VkImageMemoryBarrier2KHR barrier{
+            .sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR,
+            .srcStageMask        = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+            .srcAccessMask       = VK_ACCESS_2_MEMORY_WRITE_BIT_KHR,
+            .dstStageMask        = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+            .dstAccessMask       = VK_ACCESS_2_MEMORY_WRITE_BIT_KHR | VK_ACCESS_2_SHADER_READ_BIT_KHR,
+            .oldLayout           = VK_IMAGE_LAYOUT_UNDEFINED,
+            .newLayout           = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+            .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .image               = image,
+            .subresourceRange    = {.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT, .levelCount = 1, .layerCount = 1},
+        };
+        benchmark::DoNotOptimize(barrier);
+    }
+}
+
+void dependency_info_batch_builder(benchmark::State& state) {
+    std::array<VkImageMemoryBarrier2KHR, 4>  image_barriers{};
+    std::array<VkBufferMemoryBarrier2KHR, 2> buffer_barriers{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(image_barriers.data());
+        VkDependencyInfoKHR dependency_info = vk_lib::dependency_info_batch(image_barriers, buffer_barriers, {});
+        benchmark::DoNotOptimize(dependency_info);
+    }
+}
+
+void dependency_info_batch_designated(benchmark::State& state) {
+    std::array<VkImageMemoryBarrier2KHR, 4>  image_barriers{};
+    std::array<VkBufferMemoryBarrier2KHR, 2> buffer_barriers{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(image_barriers.data());
+        VkDependencyInfoKHR dependency_info{
+            .sType                    = VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR,
+            .bufferMemoryBarrierCount = buffer_barriers.size(),
+            .pBufferMemoryBarriers    = buffer_barriers.data(),
+            .imageMemoryBarrierCount  = image_barriers.size(),
+            .pImageMemoryBarriers     = image_barriers.data(),
+        };
+        benchmark::DoNotOptimize(dependency_info);
+    }
+}
+
+void write_descriptor_set_builder(benchmark::State& state) {
+    VkDescriptorSet       descriptor_set = handle<VkDescriptorSet>(1);
+    VkDescriptorImageInfo image_info{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(descriptor_set);
+        VkWriteDescriptorSet write = vk_lib::write_descriptor_set(0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, descriptor_set, &image_info);
+        benchmark::DoNotOptimize(write);
+    }
+}
+
+void write_descriptor_set_designated(benchmark::State& state) {
+    VkDescriptorSet       descriptor_set = handle<VkDescriptorSet>(1);
+    VkDescriptorImageInfo image_info{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(descriptor_set);
+        VkWriteDescriptorSet write{
+            .sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+            .dstSet          = descriptor_set,
+            .dstBinding      = 0,
+            .descriptorCount = 1,
+            .descriptorType  = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+            .pImageInfo      = &image_info,
+        };
+        benchmark::DoNotOptimize(write);
+    }
+}
+
+} // namespace
+
+BENCHMARK(rendering_attachment_info_builder);
+BENCHMARK(rendering_attachment_info_designated);
+BENCHMARK(rendering_info_builder);
+BENCHMARK(rendering_info_designated);
+BENCHMARK(submit_info_2_builder);
+BENCHMARK(submit_info_2_designated);
+BENCHMARK(image_memory_barrier_2_builder);
+BENCHMARK(image_memory_barrier_2_designated);
+BENCHMARK(dependency_info_batch_builder);
+BENCHMARK(dependency_info_batch_designated);
+BENCHMARK(write_descriptor_set_builder);
+BENCHMARK(write_descriptor_set_designated);
\ No newline at end of file
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include <vk_lib/commands.h>
+
+namespace {
+
+std::vector<uint32_t> pool_queue_families{};
+std::vector<uint32_t> pool_resets{};
+uintptr_t             command_buffer_count{};
+
+VkResult fake_create_command_pool(VkDevice, const VkCommandPoolCreateInfo* create_info, const VkAllocationCallbacks*, VkCommandPool* pool) {
+    pool_queue_families.push_back(create_info->queueFamilyIndex);
+    pool_resets.push_back(0);
+    *pool = reinterpret_cast<VkCommandPool>(pool_queue_families.size());
+    return VK_SUCCESS;
+}
+
+VkResult fake_allocate_command_buffers(VkDevice, const VkCommandBufferAllocateInfo*, VkCommandBuffer* command_buffer) {
+    *command_buffer = reinterpret_cast<VkCommandBuffer>(++command_buffer_count);
+    return VK_SUCCESS;
+}
+
+VkResult fake_reset_command_pool(VkDevice, VkCommandPool pool, VkCommandPoolResetFlags) {
+    pool_resets[reinterpret_cast<uintptr_t>(pool) - 1]++;
+    return VK_SUCCESS;
+}
+
+} // namespace
+
+TEST(CommandsTests, recyclesCommandBuffersPerFrame) {
+    const std::array<uint32_t, 2> queue_families{0, 2};
+    vk_lib::CommandAllocator      allocator{};
+    ASSERT_EQ(vk_lib::command_allocator_init(&allocator, fake_create_command_pool, nullptr, queue_families, 2, 3), VK_SUCCESS);
+    ASSERT_EQ(pool_queue_families.size(), 12);
+    EXPECT_EQ(pool_queue_families[2], 2);
+
+    std::array<uint32_t, 2> thread_indices{};
+    ASSERT_EQ(vk_lib::command_allocator_register_thread(&allocator, &thread_indices[0]), VK_SUCCESS);
+    ASSERT_EQ(vk_lib::command_allocator_register_thread(&allocator, &thread_indices[1]), VK_SUCCESS);
+    EXPECT_NE(thread_indices[0], thread_indices[1]);
+    uint32_t thread_index{};
+    EXPECT_EQ(vk_lib::command_allocator_register_thread(&allocator, &thread_index), VK_ERROR_TOO_MANY_OBJECTS);
+
+    std::array<VkCommandBuffer, 3> command_buffers{};
+    for (VkCommandBuffer& command_buffer : command_buffers) {
+        ASSERT_EQ(vk_lib::command_allocator_allocate(&allocator, fake_allocate_command_buffers, nullptr, thread_indices[1], 2, 1,
+                                                     VK_COMMAND_BUFFER_LEVEL_PRIMARY, &command_buffer),
+                  VK_SUCCESS);
+    }
+    EXPECT_EQ(command_buffer_count, 3);
+
+    // only the pool that was allocated from is reset, and its command buffers come back in the same order
+    ASSERT_EQ(vk_lib::command_allocator_reset_frame(&allocator, fake_reset_command_pool, nullptr, 1), VK_SUCCESS);
+    EXPECT_EQ(std::count(pool_resets.begin(), pool_resets.end(), 1), 1);
+    EXPECT_EQ(pool_resets[(1 * 2 + 1) * 2 + 1], 1);
+    VkCommandBuffer command_buffer{};
+    ASSERT_EQ(vk_lib::command_allocator_allocate(&allocator, fake_allocate_command_buffers, nullptr, thread_indices[1], 2, 1,
+                                                 VK_COMMAND_BUFFER_LEVEL_PRIMARY, &command_buffer),
+              VK_SUCCESS);
+    EXPECT_EQ(command_buffer, command_buffers[0]);
+    EXPECT_EQ(command_buffer_count, 3);
+
+    // queue family 1 has no pools, and frame 3 is past the frame count
+    EXPECT_EQ(vk_lib::command_allocator_allocate(&allocator, fake_allocate_command_buffers, nullptr, thread_indices[1], 1, 1,
+                                                 VK_COMMAND_BUFFER_LEVEL_PRIMARY, &command_buffer),
+              VK_ERROR_INITIALIZATION_FAILED);
+    EXPECT_EQ(vk_lib::command_allocator_allocate(&allocator, fake_allocate_command_buffers, nullptr, thread_indices[1], 2, 3,
+                                                 VK_COMMAND_BUFFER_LEVEL_PRIMARY, &command_buffer),
+              VK_ERROR_INITIALIZATION_FAILED);
+
+    std::vector<VkCommandPool> pools;
+    vk_lib::command_allocator_release_pools(&allocator, &pools);
+    EXPECT_EQ(pools.size(), 12);
+}
\ No newline at end of file
@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+#include <latch>
+#include <thread>
+#include <vk_lib/counters.h>
+
+TEST(CountersTests, sumsThreadsPerFrame) {
+    vk_lib::CounterSnapshot previous = vk_lib::counters_snapshot();
+
+    VK_LIB_COUNT(Submits, 1);
+    // the last thread keeps running until the first frame is taken, so the frame sums both running and exited threads
+    std::latch               last_thread_counted(1);
+    std::latch               frame_taken(1);
+    std::vector<std::thread> threads;
+    for (uint32_t thread = 0; thread < 4; thread++) {
+        threads.emplace_back([&, thread] {
+            for (uint32_t i = 0; i < 1000; i++) {
+                VK_LIB_COUNT(Barriers, 2);
+            }
+            VK_LIB_COUNT(PipelineBinds, 1);
+            if (thread == 3) {
+                last_thread_counted.count_down();
+                frame_taken.wait();
+            }
+        });
+    }
+    for (uint32_t thread = 0; thread < 3; thread++) {
+        threads[thread].join();
+    }
+    last_thread_counted.wait();
+
+    const vk_lib::CounterSnapshot frame = vk_lib::counters_frame(&previous);
+    EXPECT_EQ(frame.counts[static_cast<uint32_t>(vk_lib::Counter::Submits)], 1);
+    EXPECT_EQ(frame.counts[static_cast<uint32_t>(vk_lib::Counter::Barriers)], 4 * 2000);
+    EXPECT_EQ(frame.counts[static_cast<uint32_t>(vk_lib::Counter::PipelineBinds)], 4);
+    EXPECT_EQ(frame.counts[static_cast<uint32_t>(vk_lib::Counter::DescriptorWrites)], 0);
+    frame_taken.count_down();
+    threads[3].join();
+
+    // exited threads keep their counts, and nothing was counted since the last frame
+    const vk_lib::CounterSnapshot next_frame = vk_lib::counters_frame(&previous);
+    EXPECT_EQ(next_frame.counts, (std::array<uint64_t, vk_lib::counter_count>{}));
+    EXPECT_EQ(previous.counts[static_cast<uint32_t>(vk_lib::Counter::Barriers)], 4 * 2000);
+    EXPECT_STREQ(vk_lib::counter_name(vk_lib::Counter::DescriptorWrites), "descriptor writes");
+}
\ No newline at end of file
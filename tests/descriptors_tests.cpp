@@ -0,0 +1,289 @@
+#include <gtest/gtest.h>
+#include <set>
+#include <thread>
+#include <vk_lib/descriptors.h>
+#include <vk_lib/shader_data.h>
+
+namespace {
+
+struct FakePool {
+    uint32_t max_sets{};
+    uint32_t allocated_sets{};
+    uint32_t sampled_image_count{};
+};
+
+std::vector<FakePool> fake_pools{};
+uint32_t              reset_calls{};
+
+VkDescriptorPool pool_handle(size_t index) { return reinterpret_cast<VkDescriptorPool>(index + 1); }
+
+VkResult fake_create_descriptor_pool(VkDevice, const VkDescriptorPoolCreateInfo* create_info, const VkAllocationCallbacks*, VkDescriptorPool* pool) {
+    FakePool fake_pool{};
+    fake_pool.max_sets = create_info->maxSets;
+    for (uint32_t i = 0; i < create_info->poolSizeCount; i++) {
+        if (create_info->pPoolSizes[i].type == VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE) {
+            fake_pool.sampled_image_count = create_info->pPoolSizes[i].descriptorCount;
+        }
+    }
+    fake_pools.push_back(fake_pool);
+    *pool = pool_handle(fake_pools.size() - 1);
+    return VK_SUCCESS;
+}
+
+VkResult fake_allocate_descriptor_sets(VkDevice, const VkDescriptorSetAllocateInfo* allocate_info, VkDescriptorSet* descriptor_set) {
+    FakePool* fake_pool = &fake_pools[reinterpret_cast<uintptr_t>(allocate_info->descriptorPool) - 1];
+    if (fake_pool->allocated_sets == fake_pool->max_sets) {
+        return VK_ERROR_OUT_OF_POOL_MEMORY;
+    }
+    fake_pool->allocated_sets++;
+    *descriptor_set = reinterpret_cast<VkDescriptorSet>(uintptr_t{1});
+    return VK_SUCCESS;
+}
+
+VkResult fake_reset_descriptor_pool(VkDevice, VkDescriptorPool pool, VkDescriptorPoolResetFlags) {
+    fake_pools[reinterpret_cast<uintptr_t>(pool) - 1].allocated_sets = 0;
+    reset_calls++;
+    return VK_SUCCESS;
+}
+
+std::vector<VkWriteDescriptorSet>   captured_writes{};
+std::vector<VkDescriptorImageInfo>  captured_image_infos{};
+std::vector<VkDescriptorBufferInfo> captured_buffer_infos{};
+
+void fake_update_descriptor_sets(VkDevice, uint32_t write_count, const VkWriteDescriptorSet* writes, uint32_t, const VkCopyDescriptorSet*) {
+    captured_writes.assign(writes, writes + write_count);
+    for (uint32_t i = 0; i < write_count; i++) {
+        for (uint32_t j = 0; j < writes[i].descriptorCount; j++) {
+            if (writes[i].pImageInfo != nullptr) {
+                captured_image_infos.push_back(writes[i].pImageInfo[j]);
+            } else {
+                captured_buffer_infos.push_back(writes[i].pBufferInfo[j]);
+            }
+        }
+    }
+}
+
+void fake_get_set_layout_size(VkDevice, VkDescriptorSetLayout, VkDeviceSize* size) { *size = 80; }
+
+void fake_get_binding_offset(VkDevice, VkDescriptorSetLayout, uint32_t binding, VkDeviceSize* offset) { *offset = binding * 16; }
+
+// fills the descriptor with its size so the test can see where and how much was written
+void fake_get_descriptor(VkDevice, const VkDescriptorGetInfoEXT*, size_t size, void* descriptor) { memset(descriptor, static_cast<int>(size), size); }
+
+} // namespace
+
+TEST(DescriptorsTests, growsAndRecyclesPools) {
+    fake_pools.clear();
+    reset_calls = 0;
+
+    const std::array<vk_lib::DescriptorTypeRatio, 1> ratios{{{VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1.0f}}};
+    vk_lib::DescriptorAllocator                      allocator = vk_lib::descriptor_allocator(ratios, 4);
+
+    // each set also holds two sampled images, which the initial ratios don't mention
+    const std::array<VkDescriptorPoolSize, 2> layout_sizes{{{VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1}, {VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, 2}}};
+    for (uint32_t i = 0; i < 10; i++) {
+        VkDescriptorSet descriptor_set{};
+        ASSERT_EQ(vk_lib::descriptor_allocator_allocate(&allocator, fake_create_descriptor_pool, fake_allocate_descriptor_sets, nullptr, nullptr,
+                                                        &descriptor_set, layout_sizes),
+                  VK_SUCCESS);
+    }
+    ASSERT_EQ(fake_pools.size(), 2);
+    EXPECT_EQ(fake_pools[0].max_sets, 4);
+    EXPECT_EQ(fake_pools[1].max_sets, 6);
+    EXPECT_EQ(fake_pools[1].sampled_image_count, 12);
+    EXPECT_EQ(allocator.full_pools.size(), 1);
+
+    // a reset makes both pools usable again without creating more
+    ASSERT_EQ(vk_lib::descriptor_allocator_reset(&allocator, fake_reset_descriptor_pool, nullptr), VK_SUCCESS);
+    EXPECT_EQ(reset_calls, 2);
+    for (uint32_t i = 0; i < 10; i++) {
+        VkDescriptorSet descriptor_set{};
+        ASSERT_EQ(vk_lib::descriptor_allocator_allocate(&allocator, fake_create_descriptor_pool, fake_allocate_descriptor_sets, nullptr, nullptr,
+                                                        &descriptor_set),
+                  VK_SUCCESS);
+    }
+    EXPECT_EQ(fake_pools.size(), 2);
+
+    std::vector<VkDescriptorPool> pools;
+    vk_lib::descriptor_allocator_release_pools(&allocator, &pools);
+    EXPECT_EQ(pools.size(), 2);
+}
+
+TEST(DescriptorsTests, handsOutUniqueBindlessSlotsAcrossThreads) {
+    vk_lib::BindlessHeap heap{};
+    vk_lib::bindless_heap_init(&heap, 64, 0, 16);
+
+    uint32_t slot{};
+    EXPECT_EQ(vk_lib::bindless_heap_allocate(&heap, vk_lib::BindlessResourceType::StorageImage, &slot), VK_ERROR_OUT_OF_POOL_MEMORY);
+
+    std::array<std::vector<uint32_t>, 4> held_slots{};
+    std::vector<std::thread>             threads;
+    for (uint32_t t = 0; t < held_slots.size(); t++) {
+        threads.emplace_back([&heap, held = &held_slots[t]] {
+            for (uint32_t i = 0; i < 10000; i++) {
+                uint32_t slot{};
+                if (vk_lib::bindless_heap_allocate(&heap, vk_lib::BindlessResourceType::SampledImage, &slot) == VK_SUCCESS) {
+                    held->push_back(slot);
+                }
+                if (held->size() > 8 || (i % 3 == 0 && !held->empty())) {
+                    vk_lib::bindless_heap_free(&heap, vk_lib::BindlessResourceType::SampledImage, held->back());
+                    held->pop_back();
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    std::set<uint32_t> slots;
+    size_t             held_count = 0;
+    for (const std::vector<uint32_t>& held : held_slots) {
+        slots.insert(held.begin(), held.end());
+        held_count += held.size();
+    }
+    EXPECT_EQ(slots.size(), held_count);
+
+    // the slots still free plus the held ones cover the whole array
+    while (vk_lib::bindless_heap_allocate(&heap, vk_lib::BindlessResourceType::SampledImage, &slot) == VK_SUCCESS) {
+        EXPECT_TRUE(slots.insert(slot).second);
+    }
+    EXPECT_EQ(slots.size(), 64);
+}
+
+TEST(DescriptorsTests, batchesBindlessWrites) {
+    captured_writes.clear();
+    captured_image_infos.clear();
+    captured_buffer_infos.clear();
+
+    vk_lib::BindlessHeap heap{};
+    vk_lib::bindless_heap_init(&heap, 16, 16, 16);
+
+    const auto image_view = [](uintptr_t value) { return reinterpret_cast<VkImageView>(value); };
+    vk_lib::bindless_heap_write_image(&heap, vk_lib::BindlessResourceType::SampledImage, 4, image_view(1), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    vk_lib::bindless_heap_write_image(&heap, vk_lib::BindlessResourceType::SampledImage, 3, image_view(2), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    vk_lib::bindless_heap_write_image(&heap, vk_lib::BindlessResourceType::SampledImage, 4, image_view(3), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    vk_lib::bindless_heap_write_image(&heap, vk_lib::BindlessResourceType::SampledImage, 9, image_view(4), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    vk_lib::bindless_heap_write_buffer(&heap, 0, reinterpret_cast<VkBuffer>(uintptr_t{5}));
+    vk_lib::bindless_heap_flush(&heap, fake_update_descriptor_sets, nullptr);
+
+    ASSERT_EQ(captured_writes.size(), 3);
+    EXPECT_EQ(captured_writes[0].dstArrayElement, 3);
+    EXPECT_EQ(captured_writes[0].descriptorCount, 2);
+    EXPECT_EQ(captured_writes[1].dstArrayElement, 9);
+    EXPECT_EQ(captured_writes[2].dstBinding, static_cast<uint32_t>(vk_lib::BindlessResourceType::StorageBuffer));
+    EXPECT_EQ(captured_writes[2].descriptorType, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+
+    ASSERT_EQ(captured_image_infos.size(), 3);
+    EXPECT_EQ(captured_image_infos[0].imageView, image_view(2));
+    EXPECT_EQ(captured_image_infos[1].imageView, image_view(3));
+    EXPECT_EQ(captured_buffer_infos.size(), 1);
+    EXPECT_TRUE(heap.pending_writes.empty());
+}
+
+TEST(DescriptorsTests, writesDescriptorsIntoBuffer) {
+    std::array<VkDescriptorSetLayoutBinding, 2> bindings{};
+    bindings[0].binding         = 0;
+    bindings[0].descriptorType  = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    bindings[0].descriptorCount = 1;
+    bindings[1].binding         = 2;
+    bindings[1].descriptorType  = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+    bindings[1].descriptorCount = 4;
+
+    vk_lib::DescriptorBufferSetLayout set_layout =
+        vk_lib::descriptor_buffer_set_layout(fake_get_set_layout_size, fake_get_binding_offset, nullptr, nullptr, bindings);
+    ASSERT_EQ(set_layout.size, 80);
+    ASSERT_EQ(set_layout.bindings.size(), 3);
+    EXPECT_EQ(set_layout.bindings[2].offset, 32);
+
+    VkPhysicalDeviceDescriptorBufferPropertiesEXT properties{};
+    properties.descriptorBufferOffsetAlignment   = 64;
+    properties.uniformBufferDescriptorSize       = 8;
+    properties.robustUniformBufferDescriptorSize = 12;
+    properties.sampledImageDescriptorSize        = 4;
+
+    std::array<uint8_t, 256> memory{};
+    vk_lib::DescriptorBuffer descriptor_buffer = vk_lib::descriptor_buffer(nullptr, memory.data(), 0x10000, memory.size(),
+                                                                           VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT, &properties, true);
+
+    std::array<uint64_t, 2> set_offsets{};
+    for (uint64_t& set_offset : set_offsets) {
+        ASSERT_EQ(vk_lib::descriptor_buffer_allocate(&descriptor_buffer, &set_layout, &set_offset), VK_SUCCESS);
+    }
+    EXPECT_EQ(set_offsets[1], 128);
+    uint64_t set_offset{};
+    EXPECT_EQ(vk_lib::descriptor_buffer_allocate(&descriptor_buffer, &set_layout, &set_offset), VK_ERROR_OUT_OF_POOL_MEMORY);
+
+    VkDescriptorGetInfoEXT uniform_buffer_info = vk_lib::descriptor_get_info_ext(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, {});
+    VkDescriptorGetInfoEXT sampled_image_info  = vk_lib::descriptor_get_info_ext(VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, {});
+    vk_lib::descriptor_buffer_write(&descriptor_buffer, fake_get_descriptor, nullptr, &set_layout, set_offsets[1], 0, &uniform_buffer_info);
+    vk_lib::descriptor_buffer_write(&descriptor_buffer, fake_get_descriptor, nullptr, &set_layout, set_offsets[1], 2, &sampled_image_info, 3);
+
+    // the robust uniform buffer descriptor size is used, and array element 3 lands at 32 + 3 * 4
+    EXPECT_EQ(memory[128 + 11], 12);
+    EXPECT_EQ(memory[128 + 12], 0);
+    EXPECT_EQ(memory[128 + 43], 0);
+    EXPECT_EQ(memory[128 + 44], 4);
+    EXPECT_EQ(memory[128 + 48], 0);
+
+    VkDescriptorBufferBindingInfoEXT binding_info = vk_lib::descriptor_buffer_binding_info(&descriptor_buffer);
+    EXPECT_EQ(binding_info.address, 0x10000);
+
+    vk_lib::descriptor_buffer_reset(&descriptor_buffer);
+    ASSERT_EQ(vk_lib::descriptor_buffer_allocate(&descriptor_buffer, &set_layout, &set_offset), VK_SUCCESS);
+    EXPECT_EQ(set_offset, 0);
+}
+
+TEST(DescriptorsTests, laysOutTemplateData) {
+    std::array<VkDescriptorSetLayoutBinding, 3> bindings{};
+    bindings[0].binding         = 3;
+    bindings[0].descriptorType  = VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER;
+    bindings[0].descriptorCount = 1;
+    bindings[1].binding         = 0;
+    bindings[1].descriptorType  = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    bindings[1].descriptorCount = 2;
+    bindings[2].binding         = 1;
+    bindings[2].descriptorType  = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    bindings[2].descriptorCount = 1;
+
+    vk_lib::DescriptorTemplateLayout template_layout = vk_lib::descriptor_template_layout(bindings);
+    ASSERT_EQ(template_layout.entries.size(), 3);
+    EXPECT_EQ(template_layout.entries[0].dstBinding, 0);
+    EXPECT_EQ(template_layout.entries[1].offset, 2 * sizeof(VkDescriptorImageInfo));
+    EXPECT_EQ(template_layout.entries[2].offset, 2 * sizeof(VkDescriptorImageInfo) + sizeof(VkDescriptorBufferInfo));
+    EXPECT_EQ(template_layout.data_size, template_layout.entries[2].offset + sizeof(VkBufferView));
+
+    std::vector<uint8_t>  data(template_layout.data_size);
+    VkDescriptorImageInfo image_info{};
+    image_info.imageView = reinterpret_cast<VkImageView>(uintptr_t{7});
+    vk_lib::descriptor_template_write_image(&template_layout, data.data(), 0, image_info, 1);
+
+    VkDescriptorImageInfo written_info{};
+    memcpy(&written_info, data.data() + sizeof(VkDescriptorImageInfo), sizeof(written_info));
+    EXPECT_EQ(written_info.imageView, image_info.imageView);
+}
+
+TEST(DescriptorsTests, flushesWriteBatchOnce) {
+    captured_writes.clear();
+    captured_image_infos.clear();
+    captured_buffer_infos.clear();
+
+    vk_lib::DescriptorWriteBatch batch{};
+    for (uintptr_t i = 1; i <= 100; i++) {
+        // the infos go out of scope right after being added
+        VkDescriptorBufferInfo buffer_info  = vk_lib::descriptor_buffer_info(reinterpret_cast<VkBuffer>(i));
+        VkDescriptorImageInfo  image_info   = vk_lib::descriptor_image_info(reinterpret_cast<VkImageView>(i), VK_IMAGE_LAYOUT_GENERAL);
+        VkWriteDescriptorSet   buffer_write = vk_lib::write_descriptor_set(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, nullptr, nullptr, &buffer_info);
+        VkWriteDescriptorSet   image_write  = vk_lib::write_descriptor_set(1, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, nullptr, &image_info);
+        vk_lib::descriptor_write_batch_add(&batch, &buffer_write);
+        vk_lib::descriptor_write_batch_add(&batch, &image_write);
+    }
+    vk_lib::descriptor_write_batch_flush(&batch, fake_update_descriptor_sets, nullptr);
+
+    ASSERT_EQ(captured_writes.size(), 200);
+    ASSERT_EQ(captured_buffer_infos.size(), 100);
+    ASSERT_EQ(captured_image_infos.size(), 100);
+    EXPECT_EQ(captured_buffer_infos[99].buffer, reinterpret_cast<VkBuffer>(uintptr_t{100}));
+    EXPECT_EQ(captured_image_infos[41].imageView, reinterpret_cast<VkImageView>(uintptr_t{42}));
+    EXPECT_TRUE(batch.writes.empty());
+}
\ No newline at end of file
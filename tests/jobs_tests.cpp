@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include <vk_lib/jobs.h>
+
+namespace {
+
+std::atomic<uintptr_t>       command_buffer_count{};
+std::mutex                   recorded_mutex{};
+std::map<uintptr_t, int64_t> recorded_chunks{};
+std::vector<VkCommandBuffer> executed_command_buffers{};
+
+VkResult fake_create_command_pool(VkDevice, const VkCommandPoolCreateInfo*, const VkAllocationCallbacks*, VkCommandPool* pool) {
+    *pool = reinterpret_cast<VkCommandPool>(1);
+    return VK_SUCCESS;
+}
+
+VkResult fake_allocate_command_buffers(VkDevice, const VkCommandBufferAllocateInfo* allocate_info, VkCommandBuffer* command_buffer) {
+    EXPECT_EQ(allocate_info->level, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+    *command_buffer = reinterpret_cast<VkCommandBuffer>(++command_buffer_count);
+    return VK_SUCCESS;
+}
+
+VkResult fake_begin_command_buffer(VkCommandBuffer command_buffer, const VkCommandBufferBeginInfo* begin_info) {
+    EXPECT_NE(begin_info->pInheritanceInfo, nullptr);
+    EXPECT_EQ(begin_info->flags, VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT);
+    std::unique_lock lock(recorded_mutex);
+    recorded_chunks[reinterpret_cast<uintptr_t>(command_buffer)] = -1;
+    return VK_SUCCESS;
+}
+
+VkResult fake_end_command_buffer(VkCommandBuffer) { return VK_SUCCESS; }
+
+void fake_cmd_execute_commands(VkCommandBuffer, uint32_t command_buffer_count, const VkCommandBuffer* command_buffers) {
+    executed_command_buffers.assign(command_buffers, command_buffers + command_buffer_count);
+}
+
+} // namespace
+
+TEST(JobsTests, runsNestedJobsAcrossWorkers) {
+    vk_lib::JobSystem job_system;
+    vk_lib::job_system_start(&job_system, 3);
+    ASSERT_EQ(job_system.queue_count, 4);
+
+    std::atomic<uint32_t>                sum{};
+    std::array<std::atomic<uint32_t>, 4> jobs_per_thread{};
+    vk_lib::JobCounter                   counter;
+    for (uint32_t i = 0; i < 64; i++) {
+        vk_lib::job_system_submit(&job_system, &counter, [&](uint32_t thread_index) {
+            // jobs spawned from a job go to the running thread's deque and are waited on without blocking it
+            vk_lib::JobCounter nested_counter;
+            for (uint32_t j = 0; j < 16; j++) {
+                vk_lib::job_system_submit(&job_system, &nested_counter, [&](uint32_t nested_thread_index) {
+                    jobs_per_thread[nested_thread_index]++;
+                    sum++;
+                });
+            }
+            vk_lib::job_system_wait(&job_system, &nested_counter);
+            jobs_per_thread[thread_index]++;
+        });
+    }
+    vk_lib::job_system_wait(&job_system, &counter);
+    EXPECT_EQ(counter.remaining_jobs, 0);
+    EXPECT_EQ(sum, 64 * 16);
+    uint32_t job_count{};
+    for (const std::atomic<uint32_t>& thread_jobs : jobs_per_thread) {
+        job_count += thread_jobs;
+    }
+    EXPECT_EQ(job_count, 64 * 17);
+
+    vk_lib::job_system_stop(&job_system);
+    EXPECT_TRUE(job_system.workers.empty());
+}
+
+TEST(JobsTests, runsNoJobsOnOutsideThreads) {
+    vk_lib::JobSystem job_system;
+    vk_lib::job_system_start(&job_system, 2);
+
+    // the outside thread would otherwise run jobs with the starting thread's index
+    std::atomic<uint32_t> outside_jobs{};
+    std::thread           outside_thread([&] {
+        const std::thread::id outside_id = std::this_thread::get_id();
+        vk_lib::JobCounter    counter;
+        for (uint32_t i = 0; i < 64; i++) {
+            vk_lib::job_system_submit(&job_system, &counter, [&](uint32_t) { outside_jobs += std::this_thread::get_id() == outside_id; });
+        }
+        vk_lib::job_system_wait(&job_system, &counter);
+    });
+    outside_thread.join();
+    EXPECT_EQ(outside_jobs, 0);
+
+    vk_lib::job_system_stop(&job_system);
+}
+
+TEST(JobsTests, executesSecondariesInChunkOrder) {
+    vk_lib::JobSystem job_system;
+    vk_lib::job_system_start(&job_system, 3);
+
+    const uint32_t           queue_family = 0;
+    vk_lib::CommandAllocator command_allocator{};
+    ASSERT_EQ(vk_lib::command_allocator_init(&command_allocator, fake_create_command_pool, nullptr, {&queue_family, 1}, job_system.queue_count, 1),
+              VK_SUCCESS);
+
+    const vk_lib::SecondaryCommandFunctions functions{fake_allocate_command_buffers, fake_begin_command_buffer, fake_end_command_buffer,
+                                                      fake_cmd_execute_commands};
+    const std::array<VkFormat, 1> color_formats{VK_FORMAT_B8G8R8A8_SRGB};
+    const VkCommandBufferInheritanceRenderingInfoKHR inheritance_rendering_info = vk_lib::command_buffer_inheritance_rendering_info(color_formats);
+    const VkCommandBufferInheritanceInfo inheritance_info =
+        vk_lib::command_buffer_inheritance_info(nullptr, 0, nullptr, false, 0, 0, &inheritance_rendering_info);
+    EXPECT_EQ(inheritance_rendering_info.colorAttachmentCount, 1);
+    EXPECT_EQ(inheritance_info.pNext, &inheritance_rendering_info);
+
+    const uint32_t chunk_count = 32;
+    ASSERT_EQ(vk_lib::record_secondary_command_buffers(
+                  &job_system, &command_allocator, &functions, nullptr, queue_family, 0, VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT,
+                  &inheritance_info, chunk_count,
+                  [](VkCommandBuffer command_buffer, uint32_t chunk) {
+                      std::unique_lock lock(recorded_mutex);
+                      recorded_chunks[reinterpret_cast<uintptr_t>(command_buffer)] = chunk;
+                  },
+                  nullptr),
+              VK_SUCCESS);
+    vk_lib::job_system_stop(&job_system);
+
+    ASSERT_EQ(executed_command_buffers.size(), chunk_count);
+    for (uint32_t chunk = 0; chunk < chunk_count; chunk++) {
+        EXPECT_EQ(recorded_chunks[reinterpret_cast<uintptr_t>(executed_command_buffers[chunk])], chunk);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <vk_lib/memory.h>
+
+class TlsfTestsFixture : public testing::Test {
+  public:
+    TlsfTestsFixture() {
+        allocator = vk_lib::tlsf_allocator(0, block_size, 1024);
+        vk_lib::tlsf_add_memory_block(&allocator, fake_memory(1), block_size);
+    }
+
+    ~TlsfTestsFixture() override {}
+
+  protected:
+    static VkDeviceMemory fake_memory(uintptr_t id) { return reinterpret_cast<VkDeviceMemory>(id); }
+
+    static VkMemoryRequirements memory_requirements(uint64_t size, uint64_t alignment) {
+        VkMemoryRequirements requirements{};
+        requirements.size           = size;
+        requirements.alignment      = alignment;
+        requirements.memoryTypeBits = 1;
+        return requirements;
+    }
+
+    static constexpr uint64_t block_size = 1 << 20;
+    vk_lib::TlsfAllocator     allocator{};
+};
+
+TEST_F(TlsfTestsFixture, respectsAlignment) {
+    VkMemoryRequirements   small_requirements = memory_requirements(100, 16);
+    VkMemoryRequirements   large_requirements = memory_requirements(4096, 256);
+    vk_lib::TlsfAllocation small_allocation{};
+    vk_lib::TlsfAllocation large_allocation{};
+    ASSERT_EQ(vk_lib::tlsf_allocate(&allocator, &small_requirements, vk_lib::ResourceTiling::Linear, &small_allocation), VK_SUCCESS);
+    ASSERT_EQ(vk_lib::tlsf_allocate(&allocator, &large_requirements, vk_lib::ResourceTiling::Linear, &large_allocation), VK_SUCCESS);
+
+    EXPECT_EQ(small_allocation.offset % 16, 0);
+    EXPECT_EQ(large_allocation.offset % 256, 0);
+    EXPECT_GE(large_allocation.offset, small_allocation.offset + small_allocation.size);
+    EXPECT_EQ(small_allocation.memory, fake_memory(1));
+}
+
+TEST_F(TlsfTestsFixture, separatesLinearAndOptimalPages) {
+    VkMemoryRequirements   buffer_requirements = memory_requirements(100, 4);
+    VkMemoryRequirements   image_requirements  = memory_requirements(3000, 512);
+    vk_lib::TlsfAllocation buffer_allocation{};
+    vk_lib::TlsfAllocation image_allocation{};
+    vk_lib::TlsfAllocation next_buffer_allocation{};
+    ASSERT_EQ(vk_lib::tlsf_allocate(&allocator, &buffer_requirements, vk_lib::ResourceTiling::Linear, &buffer_allocation), VK_SUCCESS);
+    ASSERT_EQ(vk_lib::tlsf_allocate(&allocator, &image_requirements, vk_lib::ResourceTiling::Optimal, &image_allocation), VK_SUCCESS);
+    ASSERT_EQ(vk_lib::tlsf_allocate(&allocator, &buffer_requirements, vk_lib::ResourceTiling::Linear, &next_buffer_allocation), VK_SUCCESS);
+
+    // no 1024 byte page may contain both the image and a buffer
+    EXPECT_EQ(image_allocation.offset % 1024, 0);
+    EXPECT_EQ((image_allocation.offset + image_allocation.size) % 1024, 0);
+    EXPECT_TRUE(next_buffer_allocation.offset >= image_allocation.offset + image_allocation.size ||
+                next_buffer_allocation.offset + next_buffer_allocation.size <= image_allocation.offset);
+}
+
+TEST_F(TlsfTestsFixture, requestsNewBlockWhenFull) {
+    VkMemoryRequirements   requirements = memory_requirements(block_size / 2 + 1, 1);
+    vk_lib::TlsfAllocation first_allocation{};
+    vk_lib::TlsfAllocation second_allocation{};
+    ASSERT_EQ(vk_lib::tlsf_allocate(&allocator, &requirements, vk_lib::ResourceTiling::Linear, &first_allocation), VK_SUCCESS);
+    ASSERT_EQ(vk_lib::tlsf_allocate(&allocator, &requirements, vk_lib::ResourceTiling::Linear, &second_allocation),
+              VK_ERROR_OUT_OF_DEVICE_MEMORY);
+
+    vk_lib::tlsf_add_memory_block(&allocator, fake_memory(2), block_size);
+    ASSERT_EQ(vk_lib::tlsf_allocate(&allocator, &requirements, vk_lib::ResourceTiling::Linear, &second_allocation), VK_SUCCESS);
+    EXPECT_EQ(second_allocation.memory, fake_memory(2));
+}
+
+TEST_F(TlsfTestsFixture, coalescesFreedRanges) {
+    VkMemoryRequirements                requirements = memory_requirements(1000, 8);
+    std::vector<vk_lib::TlsfAllocation> allocations(64);
+    for (vk_lib::TlsfAllocation& allocation : allocations) {
+        ASSERT_EQ(vk_lib::tlsf_allocate(&allocator, &requirements, vk_lib::ResourceTiling::Linear, &allocation), VK_SUCCESS);
+    }
+    // freeing every other allocation leaves holes that cannot hold anything larger
+    for (uint32_t i = 0; i < allocations.size(); i += 2) {
+        vk_lib::tlsf_free(&allocator, &allocations[i]);
+    }
+    vk_lib::TlsfStatistics fragmented = vk_lib::tlsf_statistics(&allocator);
+    EXPECT_EQ(fragmented.allocation_count, 32);
+    EXPECT_GT(fragmented.fragmentation, 0.f);
+
+    for (uint32_t i = 1; i < allocations.size(); i += 2) {
+        vk_lib::tlsf_free(&allocator, &allocations[i]);
+    }
+    vk_lib::TlsfStatistics empty = vk_lib::tlsf_statistics(&allocator);
+    EXPECT_EQ(empty.used_size, 0);
+    EXPECT_EQ(empty.free_range_count, 1);
+    EXPECT_EQ(empty.largest_free_size, block_size);
+    EXPECT_FLOAT_EQ(empty.fragmentation, 0.f);
+
+    std::vector<VkDeviceMemory> released_memory;
+    vk_lib::tlsf_release_empty_blocks(&allocator, &released_memory);
+    ASSERT_EQ(released_memory.size(), 1);
+    EXPECT_EQ(released_memory[0], fake_memory(1));
+    EXPECT_EQ(vk_lib::tlsf_statistics(&allocator).block_count, 0);
+}
+
+TEST(MemoryTests, findMemoryTypeIndex) {
+    VkPhysicalDeviceMemoryProperties memory_properties{};
+    memory_properties.memoryTypeCount              = 3;
+    memory_properties.memoryTypes[0].propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    memory_properties.memoryTypes[1].propertyFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+    memory_properties.memoryTypes[2].propertyFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+
+    EXPECT_EQ(vk_lib::find_memory_type_index(&memory_properties, 0b111, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, VK_MEMORY_PROPERTY_HOST_COHERENT_BIT),
+              2);
+    EXPECT_EQ(vk_lib::find_memory_type_index(&memory_properties, 0b011, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, VK_MEMORY_PROPERTY_HOST_COHERENT_BIT),
+              1);
+    EXPECT_FALSE(vk_lib::find_memory_type_index(&memory_properties, 0b001, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT).has_value());
+}
\ No newline at end of file
@@ -0,0 +1,255 @@
+#include <gtest/gtest.h>
+#include <vk_lib/object_caches.h>
+#include <vk_lib/pipelines.h>
+
+namespace {
+
+uint32_t create_calls{};
+
+VkResult fake_create_graphics_pipelines(VkDevice, VkPipelineCache, uint32_t count, const VkGraphicsPipelineCreateInfo*, const VkAllocationCallbacks*,
+                                        VkPipeline* pipelines) {
+    for (uint32_t i = 0; i < count; i++) {
+        create_calls++;
+        pipelines[i] = reinterpret_cast<VkPipeline>(static_cast<uintptr_t>(create_calls));
+    }
+    return VK_SUCCESS;
+}
+
+VkResult fake_create_pipeline_layout(VkDevice, const VkPipelineLayoutCreateInfo*, const VkAllocationCallbacks*, VkPipelineLayout* layout) {
+    create_calls++;
+    *layout = reinterpret_cast<VkPipelineLayout>(static_cast<uintptr_t>(create_calls));
+    return VK_SUCCESS;
+}
+
+VkResult get_pipeline(vk_lib::PipelineObjectCache* cache, const VkGraphicsPipelineCreateInfo* create_info, VkPipeline* pipeline) {
+    return vk_lib::object_cache_get_graphics_pipeline(cache, fake_create_graphics_pipelines, nullptr, nullptr, create_info, pipeline);
+}
+
+constexpr vk_lib::StaticPipelineDesc<1, 0> opaque_desc{.cull_mode = VK_CULL_MODE_BACK_BIT, .depth_test_enable = true, .depth_write_enable = true};
+constexpr vk_lib::StaticPipelineDesc<1, 0> transparent_desc{.depth_test_enable       = true,
+                                                            .color_blend_attachments = {vk_lib::pipeline_color_blend_attachment_state(true)}};
+
+using OpaqueState      = vk_lib::StaticPipelineState<opaque_desc>;
+using TransparentState = vk_lib::StaticPipelineState<transparent_desc>;
+
+} // namespace
+
+class ObjectCachesTestsFixture : public testing::Test {
+  public:
+    ObjectCachesTestsFixture() {
+        create_calls = 0;
+
+        stages[0].sType  = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        stages[0].stage  = VK_SHADER_STAGE_VERTEX_BIT;
+        stages[0].module = reinterpret_cast<VkShaderModule>(uintptr_t{1});
+        stages[0].pName  = "main";
+        stages[1]        = stages[0];
+        stages[1].stage  = VK_SHADER_STAGE_FRAGMENT_BIT;
+        stages[1].module = reinterpret_cast<VkShaderModule>(uintptr_t{2});
+
+        rendering_create_info.sType                   = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR;
+        rendering_create_info.colorAttachmentCount    = 1;
+        rendering_create_info.pColorAttachmentFormats = &color_format;
+
+        dynamic_state.sType             = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+        dynamic_state.dynamicStateCount = dynamic_states.size();
+        dynamic_state.pDynamicStates    = dynamic_states.data();
+
+        viewport_state.sType         = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+        viewport_state.viewportCount = 1;
+        viewport_state.pViewports    = &viewport;
+        viewport_state.scissorCount  = 1;
+        viewport_state.pScissors     = &scissor;
+
+        create_info.sType          = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+        create_info.pNext          = &rendering_create_info;
+        create_info.stageCount     = stages.size();
+        create_info.pStages        = stages.data();
+        create_info.pViewportState = &viewport_state;
+        create_info.pDynamicState  = &dynamic_state;
+    }
+
+    std::array<VkPipelineShaderStageCreateInfo, 2> stages{};
+    VkFormat                                       color_format{VK_FORMAT_B8G8R8A8_SRGB};
+    VkPipelineRenderingCreateInfoKHR               rendering_create_info{};
+    std::array<VkDynamicState, 2>                  dynamic_states{VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR};
+    VkPipelineDynamicStateCreateInfo               dynamic_state{};
+    VkViewport                                     viewport{};
+    VkRect2D                                       scissor{};
+    VkPipelineViewportStateCreateInfo              viewport_state{};
+    VkGraphicsPipelineCreateInfo                   create_info{};
+    vk_lib::PipelineObjectCache                    cache{};
+};
+
+TEST_F(ObjectCachesTestsFixture, sharesIdenticalPipelines) {
+    VkPipeline first{};
+    ASSERT_EQ(get_pipeline(&cache, &create_info, &first), VK_SUCCESS);
+
+    // equal contents behind different pointers, and dynamic viewports that differ, still hit the cache
+    std::array<VkPipelineShaderStageCreateInfo, 2> stages_copy = stages;
+    std::string                                    entry_point = "main";
+
+    stages_copy[1].pName = entry_point.c_str();
+    create_info.pStages  = stages_copy.data();
+    viewport.width       = 1920;
+
+    VkPipeline second{};
+    ASSERT_EQ(get_pipeline(&cache, &create_info, &second), VK_SUCCESS);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(create_calls, 1);
+
+    color_format = VK_FORMAT_R8G8B8A8_UNORM;
+    VkPipeline third{};
+    ASSERT_EQ(get_pipeline(&cache, &create_info, &third), VK_SUCCESS);
+    EXPECT_NE(first, third);
+    EXPECT_EQ(create_calls, 2);
+    EXPECT_EQ(cache.object_count, 2);
+
+    std::vector<VkPipeline> pipelines;
+    vk_lib::object_cache_handles(&cache, &pipelines);
+    EXPECT_EQ(pipelines.size(), 2);
+}
+
+TEST_F(ObjectCachesTestsFixture, bypassesUnknownStructures) {
+    VkPipelineRenderingCreateInfoKHR unknown_structure{};
+    unknown_structure.sType     = VK_STRUCTURE_TYPE_RENDERING_INFO_KHR;
+    rendering_create_info.pNext = &unknown_structure;
+
+    vk_lib::ObjectKey key{};
+    EXPECT_FALSE(vk_lib::graphics_pipeline_key(&create_info, &key));
+
+    VkPipeline first{};
+    VkPipeline second{};
+    ASSERT_EQ(get_pipeline(&cache, &create_info, &first), VK_SUCCESS);
+    ASSERT_EQ(get_pipeline(&cache, &create_info, &second), VK_SUCCESS);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(cache.object_count, 0);
+
+    // both are still handed out for destruction
+    std::vector<VkPipeline> pipelines;
+    vk_lib::object_cache_handles(&cache, &pipelines);
+    EXPECT_EQ(pipelines, (std::vector<VkPipeline>{first, second}));
+
+    vk_lib::object_cache_clear(&cache);
+    pipelines.clear();
+    vk_lib::object_cache_handles(&cache, &pipelines);
+    EXPECT_TRUE(pipelines.empty());
+}
+
+TEST_F(ObjectCachesTestsFixture, bypassesChainedStates) {
+    // a chained tessellation domain origin would otherwise leave two different pipelines with the same key
+    VkPipelineTessellationDomainOriginStateCreateInfo domain_origin{};
+    domain_origin.sType        = VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO;
+    domain_origin.domainOrigin = VK_TESSELLATION_DOMAIN_ORIGIN_LOWER_LEFT;
+
+    VkPipelineTessellationStateCreateInfo tessellation_state{};
+    tessellation_state.sType              = VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_STATE_CREATE_INFO;
+    tessellation_state.pNext              = &domain_origin;
+    tessellation_state.patchControlPoints = 3;
+
+    stages[1].stage                = VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT;
+    create_info.pTessellationState = &tessellation_state;
+
+    vk_lib::ObjectKey key{};
+    EXPECT_FALSE(vk_lib::graphics_pipeline_key(&create_info, &key));
+
+    tessellation_state.pNext = nullptr;
+    EXPECT_TRUE(vk_lib::graphics_pipeline_key(&create_info, &key));
+
+    VkPipelineDepthStencilStateCreateInfo depth_stencil_state{};
+    depth_stencil_state.sType      = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+    depth_stencil_state.pNext      = &domain_origin;
+    create_info.pDepthStencilState = &depth_stencil_state;
+    EXPECT_FALSE(vk_lib::graphics_pipeline_key(&create_info, &key));
+}
+
+TEST_F(ObjectCachesTestsFixture, keysStaticStateByAddress) {
+    VkGraphicsPipelineCreateInfo static_create_info = vk_lib::static_graphics_pipeline_create_info<OpaqueState>(
+        nullptr, nullptr, stages, &OpaqueState::vertex_input_state, 0, 0, &rendering_create_info);
+
+    VkPipeline first{};
+    VkPipeline second{};
+    ASSERT_EQ(vk_lib::object_cache_get_static_graphics_pipeline(&cache, fake_create_graphics_pipelines, nullptr, nullptr, &static_create_info,
+                                                                OpaqueState::hash, &first),
+              VK_SUCCESS);
+    ASSERT_EQ(vk_lib::object_cache_get_static_graphics_pipeline(&cache, fake_create_graphics_pipelines, nullptr, nullptr, &static_create_info,
+                                                                OpaqueState::hash, &second),
+              VK_SUCCESS);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(create_calls, 1);
+
+    static_create_info = vk_lib::static_graphics_pipeline_create_info<TransparentState>(nullptr, nullptr, stages);
+    VkPipeline third{};
+    ASSERT_EQ(vk_lib::object_cache_get_static_graphics_pipeline(&cache, fake_create_graphics_pipelines, nullptr, nullptr, &static_create_info,
+                                                                TransparentState::hash, &third),
+              VK_SUCCESS);
+    EXPECT_NE(first, third);
+    EXPECT_EQ(cache.object_count, 2);
+}
+
+TEST(ObjectCachesTests, sharesLayoutsRegardlessOfBindingOrder) {
+    std::array<VkDescriptorSetLayoutBinding, 2> bindings{};
+    bindings[0].binding         = 0;
+    bindings[0].descriptorType  = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    bindings[0].descriptorCount = 1;
+    bindings[1].binding         = 1;
+    bindings[1].descriptorType  = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+    bindings[1].descriptorCount = 16;
+
+    std::array<VkDescriptorBindingFlags, 2>     binding_flags{0, VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT};
+    VkDescriptorSetLayoutBindingFlagsCreateInfo binding_flags_create_info{};
+    binding_flags_create_info.sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+    binding_flags_create_info.bindingCount  = binding_flags.size();
+    binding_flags_create_info.pBindingFlags = binding_flags.data();
+
+    VkDescriptorSetLayoutCreateInfo create_info{};
+    create_info.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    create_info.pNext        = &binding_flags_create_info;
+    create_info.bindingCount = bindings.size();
+    create_info.pBindings    = bindings.data();
+
+    vk_lib::ObjectKey key{};
+    ASSERT_TRUE(vk_lib::descriptor_set_layout_key(&create_info, &key));
+
+    std::swap(bindings[0], bindings[1]);
+    std::swap(binding_flags[0], binding_flags[1]);
+    vk_lib::ObjectKey reordered_key{};
+    ASSERT_TRUE(vk_lib::descriptor_set_layout_key(&create_info, &reordered_key));
+    EXPECT_EQ(key.bytes, reordered_key.bytes);
+
+    // the flags now belong to the uniform buffer
+    std::swap(binding_flags[0], binding_flags[1]);
+    vk_lib::ObjectKey changed_key{};
+    ASSERT_TRUE(vk_lib::descriptor_set_layout_key(&create_info, &changed_key));
+    EXPECT_NE(key.bytes, changed_key.bytes);
+
+    vk_lib::DescriptorSetLayoutObjectCache cache{};
+    vk_lib::object_cache_insert(&cache, key, reinterpret_cast<VkDescriptorSetLayout>(uintptr_t{1}));
+    EXPECT_EQ(vk_lib::object_cache_find(&cache, &reordered_key), reinterpret_cast<VkDescriptorSetLayout>(uintptr_t{1}));
+    EXPECT_EQ(vk_lib::object_cache_find(&cache, &changed_key), VK_NULL_HANDLE);
+}
+
+TEST(ObjectCachesTests, keepsUnkeyableLayouts) {
+    create_calls = 0;
+    VkPipelineLayoutCreateInfo create_info = vk_lib::pipeline_layout_create_info();
+
+    VkPipelineLayout                  first{};
+    VkPipelineLayout                  second{};
+    vk_lib::PipelineLayoutObjectCache cache{};
+    ASSERT_EQ(vk_lib::object_cache_get_pipeline_layout(&cache, fake_create_pipeline_layout, nullptr, &create_info, &first), VK_SUCCESS);
+    ASSERT_EQ(vk_lib::object_cache_get_pipeline_layout(&cache, fake_create_pipeline_layout, nullptr, &create_info, &second), VK_SUCCESS);
+    EXPECT_EQ(first, second);
+
+    // no chained structure can be keyed, so the layout is created again and kept for destruction
+    VkPipelineRenderingCreateInfoKHR unknown_structure{};
+    unknown_structure.sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR;
+    create_info.pNext       = &unknown_structure;
+    VkPipelineLayout unkeyed{};
+    ASSERT_EQ(vk_lib::object_cache_get_pipeline_layout(&cache, fake_create_pipeline_layout, nullptr, &create_info, &unkeyed), VK_SUCCESS);
+    EXPECT_NE(first, unkeyed);
+    EXPECT_EQ(cache.object_count, 1);
+
+    std::vector<VkPipelineLayout> layouts;
+    vk_lib::object_cache_handles(&cache, &layouts);
+    EXPECT_EQ(layouts, (std::vector<VkPipelineLayout>{first, unkeyed}));
+}
\ No newline at end of file
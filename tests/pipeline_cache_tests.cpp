@@ -0,0 +1,55 @@
+#include <cstring>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <vector>
+#include <vk_lib/pipeline_cache.h>
+
+class PipelineCacheTestsFixture : public testing::Test {
+  public:
+    PipelineCacheTestsFixture() {
+        properties.vendorID = 0x10de;
+        properties.deviceID = 0x2684;
+        std::memset(properties.pipelineCacheUUID, 7, VK_UUID_SIZE);
+
+        VkPipelineCacheHeaderVersionOne header{};
+        header.headerSize    = sizeof(header);
+        header.headerVersion = VK_PIPELINE_CACHE_HEADER_VERSION_ONE;
+        header.vendorID      = properties.vendorID;
+        header.deviceID      = properties.deviceID;
+        std::memcpy(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE);
+        cache_data.resize(sizeof(header) + 64, 3);
+        std::memcpy(cache_data.data(), &header, sizeof(header));
+    }
+
+    ~PipelineCacheTestsFixture() override { std::filesystem::remove(path); }
+
+  protected:
+    VkPhysicalDeviceProperties properties{};
+    std::vector<uint8_t>       cache_data{};
+    std::string                path = (std::filesystem::temp_directory_path() / "vk_lib_pipeline_cache_tests.bin").string();
+};
+
+TEST_F(PipelineCacheTestsFixture, roundTripsCompatibleData) {
+    ASSERT_EQ(vk_lib::pipeline_cache_file_write(path.c_str(), cache_data, &properties), VK_SUCCESS);
+
+    vk_lib::PipelineCacheFile cache_file{};
+    ASSERT_EQ(vk_lib::pipeline_cache_file_open(path.c_str(), &properties, &cache_file), VK_SUCCESS);
+    ASSERT_EQ(cache_file.data.size(), cache_data.size());
+    EXPECT_EQ(std::memcmp(cache_file.data.data(), cache_data.data(), cache_data.size()), 0);
+    vk_lib::pipeline_cache_file_close(&cache_file);
+    EXPECT_TRUE(cache_file.data.empty());
+}
+
+TEST_F(PipelineCacheTestsFixture, rejectsDataFromOtherDrivers) {
+    ASSERT_EQ(vk_lib::pipeline_cache_file_write(path.c_str(), cache_data, &properties), VK_SUCCESS);
+
+    VkPhysicalDeviceProperties updated_driver_properties = properties;
+    updated_driver_properties.pipelineCacheUUID[0]       = 8;
+    vk_lib::PipelineCacheFile cache_file{};
+    EXPECT_EQ(vk_lib::pipeline_cache_file_open(path.c_str(), &updated_driver_properties, &cache_file), VK_INCOMPLETE);
+    EXPECT_TRUE(cache_file.data.empty());
+    vk_lib::pipeline_cache_file_close(&cache_file);
+
+    EXPECT_EQ(vk_lib::pipeline_cache_file_write(path.c_str(), cache_data, &updated_driver_properties), VK_ERROR_INITIALIZATION_FAILED);
+    EXPECT_EQ(vk_lib::pipeline_cache_file_open("does_not_exist.bin", &properties, &cache_file), VK_INCOMPLETE);
+}
\ No newline at end of file
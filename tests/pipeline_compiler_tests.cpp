@@ -0,0 +1,59 @@
+#include <atomic>
+#include <gtest/gtest.h>
+#include <vk_lib/pipeline_compiler.h>
+
+namespace {
+
+constexpr VkPipelineCreateFlags failing_flags = 0xdead;
+std::atomic<uint32_t>           create_calls{};
+
+VkResult fake_create_compute_pipelines(VkDevice, VkPipelineCache, uint32_t count, const VkComputePipelineCreateInfo* create_infos,
+                                       const VkAllocationCallbacks*, VkPipeline* pipelines) {
+    create_calls++;
+    for (uint32_t i = 0; i < count; i++) {
+        // the flags carry the index so the test can check every pipeline landed in its own slot
+        pipelines[i] = reinterpret_cast<VkPipeline>(static_cast<uintptr_t>(create_infos[i].flags) + 1);
+    }
+    return create_infos[0].flags == failing_flags ? VK_ERROR_OUT_OF_HOST_MEMORY : VK_SUCCESS;
+}
+
+} // namespace
+
+class PipelineCompilerTestsFixture : public testing::Test {
+  public:
+    PipelineCompilerTestsFixture() {
+        vk_lib::pipeline_compiler_start(&compiler, 4);
+        create_calls = 0;
+    }
+
+    ~PipelineCompilerTestsFixture() override { vk_lib::pipeline_compiler_stop(&compiler); }
+
+  protected:
+    vk_lib::PipelineCompiler compiler{};
+};
+
+TEST_F(PipelineCompilerTestsFixture, compilesEveryPipelineInBatches) {
+    std::vector<VkComputePipelineCreateInfo> create_infos(100);
+    for (uint32_t i = 0; i < create_infos.size(); i++) {
+        create_infos[i].flags = i;
+    }
+    std::vector<VkPipeline> pipelines(create_infos.size());
+
+    std::atomic<bool>     completed{};
+    std::future<VkResult> future = vk_lib::pipeline_compiler_create_compute_pipelines(
+        &compiler, fake_create_compute_pipelines, nullptr, nullptr, create_infos, pipelines, [&completed](VkResult) { completed = true; }, 10);
+    EXPECT_EQ(future.get(), VK_SUCCESS);
+    EXPECT_TRUE(completed);
+    EXPECT_EQ(create_calls, 10);
+    EXPECT_EQ(pipelines[99], reinterpret_cast<VkPipeline>(100));
+}
+
+TEST_F(PipelineCompilerTestsFixture, reportsFailures) {
+    std::vector<VkComputePipelineCreateInfo> create_infos(32);
+    create_infos[16].flags = failing_flags;
+    std::vector<VkPipeline> pipelines(create_infos.size());
+
+    std::future<VkResult> future =
+        vk_lib::pipeline_compiler_create_compute_pipelines(&compiler, fake_create_compute_pipelines, nullptr, nullptr, create_infos, pipelines, {}, 8);
+    EXPECT_EQ(future.get(), VK_ERROR_OUT_OF_HOST_MEMORY);
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include <vk_lib/pipelines.h>
+#include <vk_lib/rendering.h>
+
+namespace {
+
+// static pipeline state built entirely at compile time
+constexpr std::array<VkDynamicState, 2>          dynamic_states{VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR};
+constexpr VkPipelineDynamicStateCreateInfo       dynamic_state       = vk_lib::pipeline_dynamic_state_create_info(dynamic_states);
+constexpr VkPipelineRasterizationStateCreateInfo rasterization_state =
+    vk_lib::pipeline_rasterization_state_create_info(VK_POLYGON_MODE_FILL, VK_FRONT_FACE_COUNTER_CLOCKWISE, VK_CULL_MODE_BACK_BIT);
+constexpr std::array<VkPipelineColorBlendAttachmentState, 1> color_blend_attachments{vk_lib::pipeline_color_blend_attachment_state(true)};
+
+static_assert(dynamic_state.sType == VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO);
+static_assert(dynamic_state.dynamicStateCount == 2 && dynamic_state.pDynamicStates == dynamic_states.data());
+static_assert(rasterization_state.cullMode == VK_CULL_MODE_BACK_BIT && rasterization_state.lineWidth == 1);
+static_assert(color_blend_attachments[0].blendEnable && color_blend_attachments[0].srcColorBlendFactor == VK_BLEND_FACTOR_SRC_ALPHA);
+
+constexpr vk_lib::StaticPipelineDesc<2, 1> gbuffer_desc{
+    .cull_mode               = VK_CULL_MODE_BACK_BIT,
+    .depth_test_enable       = true,
+    .depth_write_enable      = true,
+    .color_blend_attachments = {vk_lib::pipeline_color_blend_attachment_state(), vk_lib::pipeline_color_blend_attachment_state()},
+    .dynamic_states          = {VK_DYNAMIC_STATE_DEPTH_BIAS},
+};
+constexpr vk_lib::StaticPipelineDesc<0, 0> shadow_desc{.depth_test_enable = true, .depth_write_enable = true};
+
+using GbufferState = vk_lib::StaticPipelineState<gbuffer_desc>;
+using ShadowState  = vk_lib::StaticPipelineState<shadow_desc>;
+
+static_assert(GbufferState::dynamic_states == std::array{VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR, VK_DYNAMIC_STATE_DEPTH_BIAS});
+static_assert(GbufferState::dynamic_state.pDynamicStates == GbufferState::dynamic_states.data());
+static_assert(GbufferState::color_blend_state.attachmentCount == 2 && ShadowState::color_blend_state.attachmentCount == 0);
+static_assert(GbufferState::rasterization_state.cullMode == VK_CULL_MODE_BACK_BIT && GbufferState::depth_stencil_state.depthWriteEnable);
+static_assert(GbufferState::hash != ShadowState::hash && GbufferState::hash == vk_lib::static_pipeline_desc_hash(gbuffer_desc));
+
+} // namespace
+
+TEST(PipelinesTests, buildsStateAtCompileTime) {
+    constexpr VkClearValue                 clear_value{};
+    constexpr VkRenderingAttachmentInfoKHR color_attachment =
+        vk_lib::rendering_attachment_info(nullptr, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, VK_ATTACHMENT_LOAD_OP_CLEAR,
+                                          VK_ATTACHMENT_STORE_OP_STORE, &clear_value);
+    static_assert(color_attachment.loadOp == VK_ATTACHMENT_LOAD_OP_CLEAR);
+
+    const VkRenderingInfoKHR rendering_info = vk_lib::rendering_info({{0, 0}, {64, 64}}, {&color_attachment, 1});
+    EXPECT_EQ(rendering_info.colorAttachmentCount, 1);
+    EXPECT_EQ(rendering_info.pColorAttachments, &color_attachment);
+    EXPECT_EQ(rendering_info.layerCount, 1);
+}
+
+TEST(PipelinesTests, pointsAtStaticState) {
+    std::array<VkPipelineShaderStageCreateInfo, 1> stages{};
+    VkPipelineRenderingCreateInfoKHR               rendering_info = vk_lib::pipeline_rendering_create_info({}, VK_FORMAT_D32_SFLOAT);
+    VkGraphicsPipelineCreateInfo                   create_info    =
+        vk_lib::static_graphics_pipeline_create_info<ShadowState>(nullptr, nullptr, stages, &ShadowState::vertex_input_state, 0, 0, &rendering_info);
+
+    EXPECT_EQ(create_info.stageCount, 1);
+    EXPECT_EQ(create_info.pNext, &rendering_info);
+    EXPECT_EQ(create_info.pVertexInputState, &ShadowState::vertex_input_state);
+    EXPECT_EQ(create_info.pDepthStencilState, &ShadowState::depth_stencil_state);
+    EXPECT_EQ(create_info.pDynamicState->dynamicStateCount, 2);
+    EXPECT_EQ(create_info.pViewportState->viewportCount, 1);
+    EXPECT_EQ(create_info.pTessellationState, nullptr);
+}
\ No newline at end of file
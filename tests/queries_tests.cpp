@@ -0,0 +1,146 @@
+#include <bit>
+#include <gtest/gtest.h>
+#include <vk_lib/queries.h>
+
+namespace {
+
+struct FakeQueryPool {
+    uint32_t values_per_query{};
+    // written values, 0 for queries that are not available
+    std::vector<uint64_t> values{};
+};
+
+std::map<uintptr_t, FakeQueryPool> query_pools{};
+uint64_t                           current_ticks{};
+
+FakeQueryPool* fake_query_pool(VkQueryPool query_pool) { return &query_pools[reinterpret_cast<uintptr_t>(query_pool)]; }
+
+VkResult fake_create_query_pool(VkDevice, const VkQueryPoolCreateInfo* create_info, const VkAllocationCallbacks*, VkQueryPool* query_pool) {
+    const uintptr_t pool      = query_pools.size() + 1;
+    FakeQueryPool*  fake_pool = &query_pools[pool];
+
+    fake_pool->values_per_query = create_info->queryType == VK_QUERY_TYPE_PIPELINE_STATISTICS ? std::popcount(create_info->pipelineStatistics) : 1;
+    fake_pool->values.resize(create_info->queryCount * fake_pool->values_per_query);
+    *query_pool = reinterpret_cast<VkQueryPool>(pool);
+    return VK_SUCCESS;
+}
+
+VkResult fake_get_query_pool_results(VkDevice, VkQueryPool query_pool, uint32_t first_query, uint32_t query_count, size_t, void* data,
+                                     VkDeviceSize stride, VkQueryResultFlags) {
+    const FakeQueryPool* fake_pool = fake_query_pool(query_pool);
+    VkResult             result    = VK_SUCCESS;
+    for (uint32_t i = 0; i < query_count; i++) {
+        const uint64_t* values      = &fake_pool->values[(first_query + i) * fake_pool->values_per_query];
+        uint64_t*       result_data = reinterpret_cast<uint64_t*>(static_cast<uint8_t*>(data) + i * stride);
+        std::copy_n(values, fake_pool->values_per_query, result_data);
+        result_data[fake_pool->values_per_query] = values[0] != 0;
+        result                                   = values[0] != 0 ? result : VK_NOT_READY;
+    }
+    return result;
+}
+
+void fake_cmd_reset_query_pool(VkCommandBuffer, VkQueryPool query_pool, uint32_t first_query, uint32_t query_count) {
+    FakeQueryPool* fake_pool = fake_query_pool(query_pool);
+    std::fill_n(fake_pool->values.begin() + first_query * fake_pool->values_per_query, query_count * fake_pool->values_per_query, 0);
+}
+
+void fake_cmd_write_timestamp_2(VkCommandBuffer, VkPipelineStageFlags2, VkQueryPool query_pool, uint32_t query) {
+    current_ticks += 1000;
+    fake_query_pool(query_pool)->values[query] = current_ticks;
+}
+
+std::vector<VkQueryControlFlags> begun_query_flags{};
+
+void fake_cmd_begin_query(VkCommandBuffer, VkQueryPool, uint32_t, VkQueryControlFlags flags) { begun_query_flags.push_back(flags); }
+
+// every value of a query is its pool's id times 100 plus the value's index
+void fake_cmd_end_query(VkCommandBuffer, VkQueryPool query_pool, uint32_t query) {
+    FakeQueryPool* fake_pool = fake_query_pool(query_pool);
+    for (uint32_t i = 0; i < fake_pool->values_per_query; i++) {
+        fake_pool->values[query * fake_pool->values_per_query + i] = reinterpret_cast<uintptr_t>(query_pool) * 100 + i;
+    }
+}
+
+} // namespace
+
+TEST(QueriesTests, readsBackZonesFramesLater) {
+    vk_lib::GpuProfiler profiler{};
+    ASSERT_EQ(vk_lib::gpu_profiler_init(&profiler, fake_create_query_pool, nullptr, 2, 2, 2.f, 64), VK_SUCCESS);
+
+    for (uint32_t frame = 0; frame < 2; frame++) {
+        ASSERT_EQ(vk_lib::gpu_profiler_begin_frame(&profiler, fake_get_query_pool_results, fake_cmd_reset_query_pool, nullptr, nullptr, frame),
+                  VK_SUCCESS);
+        EXPECT_TRUE(profiler.results.empty());
+        vk_lib::GpuProfilerScope frame_scope(&profiler, fake_cmd_write_timestamp_2, nullptr, "frame");
+        vk_lib::gpu_profiler_begin_zone(&profiler, fake_cmd_write_timestamp_2, nullptr, "pass");
+        // past max_zones_per_frame, dropped without writing
+        vk_lib::gpu_profiler_begin_zone(&profiler, fake_cmd_write_timestamp_2, nullptr, "dropped");
+        vk_lib::gpu_profiler_end_zone(&profiler, fake_cmd_write_timestamp_2, nullptr);
+        vk_lib::gpu_profiler_end_zone(&profiler, fake_cmd_write_timestamp_2, nullptr);
+    }
+    EXPECT_EQ(current_ticks, 8000);
+
+    // frame 2 reuses frame 0's pool and gets its zones, the ticks are 2ns each
+    ASSERT_EQ(vk_lib::gpu_profiler_begin_frame(&profiler, fake_get_query_pool_results, fake_cmd_reset_query_pool, nullptr, nullptr, 0),
+              VK_SUCCESS);
+    ASSERT_EQ(profiler.results.size(), 2);
+    EXPECT_STREQ(profiler.results[0].name, "frame");
+    EXPECT_EQ(profiler.results[0].depth, 0);
+    EXPECT_EQ(profiler.results[0].frame_number, 0);
+    EXPECT_DOUBLE_EQ(profiler.results[0].begin_us, 2.0);
+    EXPECT_DOUBLE_EQ(profiler.results[0].duration_us, 6.0);
+    EXPECT_STREQ(profiler.results[1].name, "pass");
+    EXPECT_EQ(profiler.results[1].depth, 1);
+    EXPECT_DOUBLE_EQ(profiler.results[1].duration_us, 2.0);
+
+    std::string json;
+    vk_lib::chrome_trace_json(profiler.results, &json);
+    EXPECT_TRUE(json.starts_with(R"({"traceEvents":[{"name":"frame","cat":"gpu")"));
+    EXPECT_NE(json.find(R"("ph":"X","ts":2.000,"dur":6.000)"), std::string::npos);
+    EXPECT_EQ(json.back(), '}');
+
+    std::vector<VkQueryPool> released_pools;
+    vk_lib::gpu_profiler_release_query_pools(&profiler, &released_pools);
+    EXPECT_EQ(released_pools.size(), 2);
+}
+
+TEST(QueriesTests, readsBackPassStatistics) {
+    query_pools.clear();
+    vk_lib::PassQueries queries{};
+    ASSERT_EQ(vk_lib::pass_queries_init(&queries, fake_create_query_pool, nullptr, 2, 2), VK_SUCCESS);
+
+    for (uint32_t frame = 0; frame < 2; frame++) {
+        ASSERT_EQ(vk_lib::pass_queries_begin_frame(&queries, fake_get_query_pool_results, fake_cmd_reset_query_pool, nullptr, nullptr, frame),
+                  VK_SUCCESS);
+        EXPECT_TRUE(queries.results.empty());
+        vk_lib::pass_queries_begin_scope(&queries, fake_cmd_begin_query, nullptr, "opaque", true, true, VK_QUERY_CONTROL_PRECISE_BIT);
+        vk_lib::pass_queries_end_scope(&queries, fake_cmd_end_query, nullptr);
+        vk_lib::pass_queries_begin_scope(&queries, fake_cmd_begin_query, nullptr, "particles");
+        vk_lib::pass_queries_end_scope(&queries, fake_cmd_end_query, nullptr);
+        // past max_scopes_per_frame for statistics, only the occlusion query is begun
+        vk_lib::pass_queries_begin_scope(&queries, fake_cmd_begin_query, nullptr, "transparent", true, true);
+        vk_lib::pass_queries_end_scope(&queries, fake_cmd_end_query, nullptr);
+    }
+    EXPECT_EQ(begun_query_flags, (std::vector<VkQueryControlFlags>{0, VK_QUERY_CONTROL_PRECISE_BIT, 0, 0, 0, VK_QUERY_CONTROL_PRECISE_BIT, 0, 0}));
+
+    // frame 2 reuses frame 0's pools, statistics pool 1 and occlusion pool 2
+    ASSERT_EQ(vk_lib::pass_queries_begin_frame(&queries, fake_get_query_pool_results, fake_cmd_reset_query_pool, nullptr, nullptr, 0),
+              VK_SUCCESS);
+    ASSERT_EQ(queries.results.size(), 3);
+    EXPECT_STREQ(queries.results[0].name, "opaque");
+    EXPECT_EQ(queries.results[0].frame_number, 0);
+    ASSERT_TRUE(queries.results[0].has_statistics);
+    EXPECT_EQ(queries.results[0].statistics.input_assembly_vertices, 100);
+    EXPECT_EQ(queries.results[0].statistics.clipping_primitives, 103);
+    EXPECT_EQ(queries.results[0].statistics.compute_shader_invocations, 105);
+    ASSERT_TRUE(queries.results[0].has_occlusion);
+    EXPECT_EQ(queries.results[0].samples_passed, 200);
+    EXPECT_TRUE(queries.results[1].has_statistics);
+    EXPECT_FALSE(queries.results[1].has_occlusion);
+    EXPECT_FALSE(queries.results[2].has_statistics);
+    EXPECT_TRUE(queries.results[2].has_occlusion);
+
+    std::vector<VkQueryPool> released_pools;
+    vk_lib::pass_queries_release_query_pools(&queries, &released_pools);
+    EXPECT_EQ(released_pools.size(), 4);
+}
\ No newline at end of file
@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include <vk_lib/commands.h>
+#include <vk_lib/queues.h>
+#include <vk_lib/synchronization.h>
+
+namespace {
+
+struct RecordedSubmit {
+    VkQueue                                   queue{};
+    std::vector<std::vector<VkCommandBuffer>> command_buffers{};
+    std::vector<uint32_t>                     wait_counts{};
+    std::vector<uint32_t>                     signal_counts{};
+    std::vector<uint64_t>                     wait_values{};
+    std::vector<uint64_t>                     signal_values{};
+};
+
+std::vector<RecordedSubmit> recorded_submits{};
+
+VkResult fake_queue_submit_2(VkQueue queue, uint32_t submit_count, const VkSubmitInfo2KHR* submit_infos, VkFence) {
+    RecordedSubmit recorded_submit{};
+    recorded_submit.queue = queue;
+    for (uint32_t i = 0; i < submit_count; i++) {
+        std::vector<VkCommandBuffer>& command_buffers = recorded_submit.command_buffers.emplace_back();
+        for (uint32_t j = 0; j < submit_infos[i].commandBufferInfoCount; j++) {
+            command_buffers.push_back(submit_infos[i].pCommandBufferInfos[j].commandBuffer);
+        }
+        recorded_submit.wait_counts.push_back(submit_infos[i].waitSemaphoreInfoCount);
+        recorded_submit.signal_counts.push_back(submit_infos[i].signalSemaphoreInfoCount);
+        for (uint32_t j = 0; j < submit_infos[i].waitSemaphoreInfoCount; j++) {
+            recorded_submit.wait_values.push_back(submit_infos[i].pWaitSemaphoreInfos[j].value);
+        }
+        for (uint32_t j = 0; j < submit_infos[i].signalSemaphoreInfoCount; j++) {
+            recorded_submit.signal_values.push_back(submit_infos[i].pSignalSemaphoreInfos[j].value);
+        }
+    }
+    recorded_submits.push_back(recorded_submit);
+    return VK_SUCCESS;
+}
+
+uintptr_t semaphore_count{};
+
+VkResult fake_create_semaphore(VkDevice, const VkSemaphoreCreateInfo*, const VkAllocationCallbacks*, VkSemaphore* semaphore) {
+    *semaphore = reinterpret_cast<VkSemaphore>(++semaphore_count);
+    return VK_SUCCESS;
+}
+
+void fake_get_device_queue(VkDevice, uint32_t family_index, uint32_t queue_index, VkQueue* queue) {
+    *queue = reinterpret_cast<VkQueue>((family_index + 1) * 16 + queue_index);
+}
+
+VkQueueFamilyProperties queue_family(VkQueueFlags queue_flags, uint32_t queue_count) {
+    VkQueueFamilyProperties properties{};
+    properties.queueFlags = queue_flags;
+    properties.queueCount = queue_count;
+    return properties;
+}
+
+VkCommandBuffer command_buffer(uintptr_t id) { return reinterpret_cast<VkCommandBuffer>(id); }
+
+} // namespace
+
+TEST(QueuesTests, mergesSubmissionsIntoOneCall) {
+    const std::array<VkQueue, 2> queues{reinterpret_cast<VkQueue>(1), reinterpret_cast<VkQueue>(2)};
+    vk_lib::SubmitBatcher        batcher{};
+    vk_lib::submit_batcher_init(&batcher, queues);
+
+    const VkSemaphore              semaphore   = reinterpret_cast<VkSemaphore>(1);
+    const VkSemaphoreSubmitInfoKHR wait_info   = vk_lib::semaphore_submit_info(semaphore, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT);
+    const VkSemaphoreSubmitInfoKHR signal_info = vk_lib::semaphore_submit_info(semaphore, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT);
+    std::array<VkCommandBufferSubmitInfoKHR, 4> command_buffer_infos{};
+    for (uint32_t i = 0; i < command_buffer_infos.size(); i++) {
+        command_buffer_infos[i] = vk_lib::command_buffer_submit_info(command_buffer(i + 1));
+    }
+
+    // waits then merges with the plain one after it, which merges with the signalling one, the last waits again and stays apart
+    const std::array<VkSubmitInfo2KHR, 4> submit_infos{
+        vk_lib::submit_info_2(&command_buffer_infos[0], &wait_info),
+        vk_lib::submit_info_2(&command_buffer_infos[1]),
+        vk_lib::submit_info_2(&command_buffer_infos[2], nullptr, &signal_info),
+        vk_lib::submit_info_2(&command_buffer_infos[3], &wait_info),
+    };
+    for (const VkSubmitInfo2KHR& submit_info : submit_infos) {
+        vk_lib::submit_batcher_enqueue(&batcher, 1, &submit_info);
+    }
+
+    ASSERT_EQ(vk_lib::submit_batcher_flush(&batcher, fake_queue_submit_2, 0), VK_SUCCESS);
+    EXPECT_TRUE(recorded_submits.empty());
+    ASSERT_EQ(vk_lib::submit_batcher_flush(&batcher, fake_queue_submit_2, 1), VK_SUCCESS);
+    ASSERT_EQ(recorded_submits.size(), 1);
+    const RecordedSubmit& recorded_submit = recorded_submits[0];
+    EXPECT_EQ(recorded_submit.queue, queues[1]);
+    ASSERT_EQ(recorded_submit.command_buffers.size(), 2);
+    EXPECT_EQ(recorded_submit.command_buffers[0], (std::vector{command_buffer(1), command_buffer(2), command_buffer(3)}));
+    EXPECT_EQ(recorded_submit.wait_counts, (std::vector<uint32_t>{1, 1}));
+    EXPECT_EQ(recorded_submit.signal_counts, (std::vector<uint32_t>{1, 0}));
+
+    ASSERT_EQ(vk_lib::submit_batcher_flush(&batcher, fake_queue_submit_2, 1), VK_SUCCESS);
+    EXPECT_EQ(recorded_submits.size(), 1);
+}
+
+TEST(QueuesTests, enqueuesFromManyThreads) {
+    const VkQueue         queue = reinterpret_cast<VkQueue>(1);
+    vk_lib::SubmitBatcher batcher{};
+    vk_lib::submit_batcher_init(&batcher, {&queue, 1});
+    recorded_submits.clear();
+
+    std::vector<std::thread> threads;
+    for (uintptr_t thread = 0; thread < 4; thread++) {
+        threads.emplace_back([&batcher, thread] {
+            for (uintptr_t i = 0; i < 64; i++) {
+                const VkCommandBufferSubmitInfoKHR command_buffer_info = vk_lib::command_buffer_submit_info(command_buffer(thread * 64 + i + 1));
+                const VkSubmitInfo2KHR             submit_info         = vk_lib::submit_info_2(&command_buffer_info);
+                vk_lib::submit_batcher_enqueue(&batcher, 0, &submit_info);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(vk_lib::submit_batcher_flush(&batcher, fake_queue_submit_2, 0), VK_SUCCESS);
+    ASSERT_EQ(recorded_submits.size(), 1);
+    ASSERT_EQ(recorded_submits[0].command_buffers.size(), 1);
+    EXPECT_EQ(recorded_submits[0].command_buffers[0].size(), 4 * 64);
+}
+
+TEST(QueuesTests, picksDedicatedQueueFamilies) {
+    const std::array<VkQueueFamilyProperties, 3> dedicated_families{
+        queue_family(VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, 1),
+        queue_family(VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, 2),
+        queue_family(VK_QUEUE_TRANSFER_BIT, 1),
+    };
+    vk_lib::QueueSetup setup{};
+    vk_lib::queue_setup_init(&setup, dedicated_families, 0);
+    EXPECT_EQ(vk_lib::queue_setup_family(&setup, vk_lib::QueueRole::Graphics), 0);
+    EXPECT_EQ(vk_lib::queue_setup_family(&setup, vk_lib::QueueRole::Compute), 1);
+    EXPECT_EQ(vk_lib::queue_setup_family(&setup, vk_lib::QueueRole::Transfer), 2);
+    EXPECT_EQ(setup.queue_create_infos.size(), 3);
+    std::vector<VkQueue> queues;
+    vk_lib::queue_setup_get_queues(&setup, fake_get_device_queue, nullptr, &queues);
+    EXPECT_EQ(queues[setup.role_queues[static_cast<uint32_t>(vk_lib::QueueRole::Compute)]], reinterpret_cast<VkQueue>(32));
+
+    // a second queue of the only family goes to compute, transfer shares it and takes the higher priority
+    const VkQueueFamilyProperties general_family = queue_family(VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, 2);
+    vk_lib::queue_setup_init(&setup, {&general_family, 1}, 0, {1.f, 0.5f, 0.75f});
+    ASSERT_EQ(setup.queue_create_infos.size(), 1);
+    EXPECT_EQ(setup.queue_create_infos[0].queueCount, 2);
+    EXPECT_EQ(setup.queue_create_infos[0].pQueuePriorities[1], 0.75f);
+    EXPECT_EQ(setup.role_queues, (std::array<uint32_t, vk_lib::queue_role_count>{0, 1, 1}));
+}
+
+TEST(QueuesTests, ordersAsyncComputeWithTimelines) {
+    const std::array<VkQueue, 2> queues{reinterpret_cast<VkQueue>(1), reinterpret_cast<VkQueue>(2)};
+    vk_lib::SubmitBatcher        batcher{};
+    vk_lib::submit_batcher_init(&batcher, queues);
+    vk_lib::AsyncComputeScheduler scheduler{};
+    ASSERT_EQ(vk_lib::async_compute_init(&scheduler, fake_create_semaphore, nullptr, &batcher, 0, 1), VK_SUCCESS);
+    recorded_submits.clear();
+
+    const VkCommandBufferSubmitInfoKHR command_buffer_info = vk_lib::command_buffer_submit_info(command_buffer(1));
+    const VkSubmitInfo2KHR             submit_info         = vk_lib::submit_info_2(&command_buffer_info);
+    const uint64_t              particles = vk_lib::async_compute_submit(&scheduler, vk_lib::QueueRole::Compute, &submit_info);
+    const vk_lib::ScheduledWait wait{vk_lib::QueueRole::Compute, particles, VK_PIPELINE_STAGE_2_VERTEX_INPUT_BIT};
+    const uint64_t              frame = vk_lib::async_compute_submit(&scheduler, vk_lib::QueueRole::Graphics, &submit_info, {&wait, 1});
+    EXPECT_EQ(particles, 1);
+    EXPECT_EQ(frame, 1);
+
+    ASSERT_EQ(vk_lib::submit_batcher_flush(&batcher, fake_queue_submit_2, 1), VK_SUCCESS);
+    ASSERT_EQ(vk_lib::submit_batcher_flush(&batcher, fake_queue_submit_2, 0), VK_SUCCESS);
+    ASSERT_EQ(recorded_submits.size(), 2);
+    EXPECT_EQ(recorded_submits[0].queue, queues[1]);
+    EXPECT_TRUE(recorded_submits[0].wait_values.empty());
+    EXPECT_EQ(recorded_submits[0].signal_values, std::vector<uint64_t>{1});
+    EXPECT_EQ(recorded_submits[1].wait_values, std::vector<uint64_t>{1});
+    EXPECT_EQ(recorded_submits[1].signal_values, std::vector<uint64_t>{1});
+}
\ No newline at end of file
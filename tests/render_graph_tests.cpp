@@ -0,0 +1,139 @@
+#include <array>
+#include <gtest/gtest.h>
+#include <vk_lib/render_graph.h>
+#include <vk_lib/resources.h>
+
+class RenderGraphTestsFixture : public testing::Test {
+  public:
+    RenderGraphTestsFixture() {}
+
+    ~RenderGraphTestsFixture() override {}
+
+  protected:
+    uint32_t import_color_image(uintptr_t id, VkImageLayout final_layout = VK_IMAGE_LAYOUT_UNDEFINED) {
+        return vk_lib::render_graph_import_image(&graph, reinterpret_cast<VkImage>(id), reinterpret_cast<VkImageView>(id), color_range,
+                                                 VK_IMAGE_LAYOUT_UNDEFINED, final_layout, VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT,
+                                                 VK_ACCESS_2_NONE);
+    }
+
+    vk_lib::RenderGraph     graph{};
+    VkImageSubresourceRange color_range = vk_lib::image_subresource_range(VK_IMAGE_ASPECT_COLOR_BIT);
+};
+
+TEST_F(RenderGraphTestsFixture, cullsAndOrdersPasses) {
+    const uint32_t albedo    = import_color_image(1);
+    const uint32_t normals   = import_color_image(2);
+    const uint32_t swapchain = import_color_image(3, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
+
+    const uint32_t albedo_pass = vk_lib::render_graph_add_pass(&graph, "albedo");
+    vk_lib::render_graph_color_attachment(&graph, albedo_pass, albedo, VK_ATTACHMENT_LOAD_OP_CLEAR, VK_ATTACHMENT_STORE_OP_STORE);
+    const uint32_t normals_pass = vk_lib::render_graph_add_pass(&graph, "normals");
+    vk_lib::render_graph_color_attachment(&graph, normals_pass, normals, VK_ATTACHMENT_LOAD_OP_CLEAR, VK_ATTACHMENT_STORE_OP_STORE);
+    const uint32_t debug_pass = vk_lib::render_graph_add_pass(&graph, "debug");
+    vk_lib::render_graph_use_image(&graph, debug_pass, normals, vk_lib::ResourceAccess::Read, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                                   VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT, VK_ACCESS_2_SHADER_READ_BIT);
+    const uint32_t lighting_pass = vk_lib::render_graph_add_pass(&graph, "lighting");
+    vk_lib::render_graph_use_image(&graph, lighting_pass, albedo, vk_lib::ResourceAccess::Read, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                                   VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT, VK_ACCESS_2_SHADER_READ_BIT);
+    vk_lib::render_graph_color_attachment(&graph, lighting_pass, swapchain, VK_ATTACHMENT_LOAD_OP_DONT_CARE, VK_ATTACHMENT_STORE_OP_STORE);
+    vk_lib::render_graph_compile(&graph);
+
+    // the debug pass writes nothing, the independent normals pass is moved between albedo and its consumer
+    EXPECT_EQ(graph.pass_order, (std::vector<uint32_t>{albedo_pass, normals_pass, lighting_pass}));
+
+    VkDependencyInfoKHR lighting_dependency_info = vk_lib::render_graph_pass_dependency_info(&graph, lighting_pass);
+    ASSERT_EQ(lighting_dependency_info.imageMemoryBarrierCount, 2);
+    const VkImageMemoryBarrier2KHR* albedo_barrier = &lighting_dependency_info.pImageMemoryBarriers[0];
+    EXPECT_EQ(albedo_barrier->oldLayout, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+    EXPECT_EQ(albedo_barrier->newLayout, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    EXPECT_EQ(albedo_barrier->srcAccessMask, VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT);
+    EXPECT_EQ(albedo_barrier->dstStageMask, VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT);
+    EXPECT_EQ(lighting_dependency_info.pImageMemoryBarriers[1].newLayout, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+
+    VkDependencyInfoKHR final_dependency_info = vk_lib::render_graph_final_dependency_info(&graph);
+    ASSERT_EQ(final_dependency_info.imageMemoryBarrierCount, 1);
+    EXPECT_EQ(final_dependency_info.pImageMemoryBarriers[0].image, reinterpret_cast<VkImage>(3));
+    EXPECT_EQ(final_dependency_info.pImageMemoryBarriers[0].newLayout, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
+
+    VkRenderingInfoKHR rendering_info = vk_lib::render_graph_rendering_info(&graph, lighting_pass);
+    ASSERT_EQ(rendering_info.colorAttachmentCount, 1);
+    EXPECT_EQ(rendering_info.pColorAttachments[0].imageView, reinterpret_cast<VkImageView>(3));
+}
+
+TEST_F(RenderGraphTestsFixture, coversConsecutiveReadsWithOneBarrier) {
+    const uint32_t buffer = vk_lib::render_graph_import_buffer(&graph, reinterpret_cast<VkBuffer>(1), 0, VK_WHOLE_SIZE, VK_PIPELINE_STAGE_2_NONE,
+                                                               VK_ACCESS_2_NONE);
+
+    const uint32_t write_pass = vk_lib::render_graph_add_pass(&graph, "write");
+    vk_lib::render_graph_use_buffer(&graph, write_pass, buffer, vk_lib::ResourceAccess::Write, VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
+                                    VK_ACCESS_2_SHADER_WRITE_BIT);
+    const uint32_t vertex_pass = vk_lib::render_graph_add_pass(&graph, "vertex", {}, true);
+    vk_lib::render_graph_use_buffer(&graph, vertex_pass, buffer, vk_lib::ResourceAccess::Read, VK_PIPELINE_STAGE_2_VERTEX_INPUT_BIT,
+                                    VK_ACCESS_2_VERTEX_ATTRIBUTE_READ_BIT);
+    const uint32_t compute_pass = vk_lib::render_graph_add_pass(&graph, "compute", {}, true);
+    vk_lib::render_graph_use_buffer(&graph, compute_pass, buffer, vk_lib::ResourceAccess::Read, VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
+                                    VK_ACCESS_2_SHADER_READ_BIT);
+    const uint32_t rewrite_pass = vk_lib::render_graph_add_pass(&graph, "rewrite");
+    vk_lib::render_graph_use_buffer(&graph, rewrite_pass, buffer, vk_lib::ResourceAccess::Write, VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
+                                    VK_ACCESS_2_SHADER_WRITE_BIT);
+    vk_lib::render_graph_compile(&graph);
+
+    EXPECT_TRUE(vk_lib::barrier_batch_empty(&graph.pass_barriers[write_pass]));
+    ASSERT_EQ(graph.pass_barriers[vertex_pass].buffer_barriers.size(), 1);
+    EXPECT_EQ(graph.pass_barriers[vertex_pass].buffer_barriers[0].dstStageMask,
+              VK_PIPELINE_STAGE_2_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT);
+    EXPECT_TRUE(vk_lib::barrier_batch_empty(&graph.pass_barriers[compute_pass]));
+    ASSERT_EQ(graph.pass_barriers[rewrite_pass].buffer_barriers.size(), 1);
+    EXPECT_EQ(graph.pass_barriers[rewrite_pass].buffer_barriers[0].srcStageMask,
+              VK_PIPELINE_STAGE_2_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT);
+}
+
+TEST_F(RenderGraphTestsFixture, aliasesTransientImages) {
+    VkMemoryRequirements large_requirements{};
+    large_requirements.size           = 1000;
+    large_requirements.alignment      = 256;
+    large_requirements.memoryTypeBits = 0b11;
+    VkMemoryRequirements small_requirements = large_requirements;
+    small_requirements.size                 = 500;
+    small_requirements.memoryTypeBits       = 0b10;
+
+    const uint32_t gbuffer  = vk_lib::render_graph_add_transient_image(&graph, reinterpret_cast<VkImage>(1), reinterpret_cast<VkImageView>(1),
+                                                                       color_range, &large_requirements);
+    const uint32_t lighting = vk_lib::render_graph_add_transient_image(&graph, reinterpret_cast<VkImage>(2), reinterpret_cast<VkImageView>(2),
+                                                                       color_range, &large_requirements);
+    const uint32_t bloom    = vk_lib::render_graph_add_transient_image(&graph, reinterpret_cast<VkImage>(3), reinterpret_cast<VkImageView>(3),
+                                                                       color_range, &small_requirements);
+
+    const uint32_t swapchain = import_color_image(4, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
+
+    const std::array<uint32_t, 4> chain = {gbuffer, lighting, bloom, swapchain};
+    std::vector<uint32_t>         passes;
+    for (uint32_t i = 0; i < chain.size(); i++) {
+        const uint32_t pass = vk_lib::render_graph_add_pass(&graph, "pass");
+        if (i > 0) {
+            vk_lib::render_graph_use_image(&graph, pass, chain[i - 1], vk_lib::ResourceAccess::Read, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                                           VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT, VK_ACCESS_2_SHADER_READ_BIT);
+        }
+        vk_lib::render_graph_color_attachment(&graph, pass, chain[i], VK_ATTACHMENT_LOAD_OP_CLEAR, VK_ATTACHMENT_STORE_OP_STORE);
+        passes.push_back(pass);
+    }
+    vk_lib::render_graph_compile(&graph);
+
+    // the gbuffer is dead once the lighting pass has read it, so bloom takes over its memory
+    EXPECT_EQ(graph.resources[gbuffer].memory_offset, 0);
+    EXPECT_EQ(graph.resources[lighting].memory_offset, 1024);
+    EXPECT_EQ(graph.resources[bloom].memory_offset, 0);
+    EXPECT_EQ(graph.transient_memory_size, 2024);
+    EXPECT_EQ(graph.transient_memory_type_bits, 0b10);
+
+    const vk_lib::BarrierBatch* bloom_barriers = &graph.pass_barriers[passes[2]];
+    ASSERT_EQ(bloom_barriers->image_barriers.size(), 2);
+    EXPECT_EQ(bloom_barriers->image_barriers[1].image, reinterpret_cast<VkImage>(3));
+    EXPECT_EQ(bloom_barriers->image_barriers[1].oldLayout, VK_IMAGE_LAYOUT_UNDEFINED);
+    EXPECT_EQ(bloom_barriers->image_barriers[1].srcStageMask & VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT);
+
+    std::vector<VkBindImageMemoryInfo> bind_infos;
+    vk_lib::render_graph_transient_bind_infos(&graph, reinterpret_cast<VkDeviceMemory>(5), 4096, &bind_infos);
+    ASSERT_EQ(bind_infos.size(), 3);
+    EXPECT_EQ(bind_infos[1].memoryOffset, 4096 + 1024);
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+#include <vk_lib/synchronization.h>
+
+namespace {
+
+VkSemaphoreType       created_semaphore_type{};
+uint64_t              semaphore_value{};
+std::vector<uint64_t> waited_values{};
+
+VkResult fake_create_semaphore(VkDevice, const VkSemaphoreCreateInfo* create_info, const VkAllocationCallbacks*, VkSemaphore* semaphore) {
+    created_semaphore_type = static_cast<const VkSemaphoreTypeCreateInfoKHR*>(create_info->pNext)->semaphoreType;
+    *semaphore             = reinterpret_cast<VkSemaphore>(1);
+    return VK_SUCCESS;
+}
+
+VkResult fake_wait_semaphores(VkDevice, const VkSemaphoreWaitInfoKHR* wait_info, uint64_t) {
+    waited_values.push_back(wait_info->pValues[0]);
+    return wait_info->pValues[0] <= semaphore_value ? VK_SUCCESS : VK_TIMEOUT;
+}
+
+} // namespace
+
+TEST(SynchronizationTests, waitsForFramesOnTimelineValues) {
+    vk_lib::FrameContext frame_context{};
+    ASSERT_EQ(vk_lib::frame_context_init(&frame_context, fake_create_semaphore, nullptr, 2), VK_SUCCESS);
+    EXPECT_EQ(created_semaphore_type, VK_SEMAPHORE_TYPE_TIMELINE);
+
+    // the first frame_count frames have nothing to wait for
+    uint32_t frame_index{};
+    for (uint32_t i = 0; i < 2; i++) {
+        ASSERT_EQ(vk_lib::frame_context_begin(&frame_context, fake_wait_semaphores, nullptr, &frame_index, 0), VK_SUCCESS);
+        EXPECT_EQ(frame_index, i);
+        EXPECT_EQ(vk_lib::frame_context_signal_info(&frame_context).value, i + 1);
+    }
+    EXPECT_TRUE(waited_values.empty());
+
+    // frame 2 reuses frame 0's index and waits for its value
+    EXPECT_EQ(vk_lib::frame_context_begin(&frame_context, fake_wait_semaphores, nullptr, &frame_index, 0), VK_TIMEOUT);
+    EXPECT_EQ(frame_context.frame_number, 2);
+    semaphore_value = 1;
+    ASSERT_EQ(vk_lib::frame_context_begin(&frame_context, fake_wait_semaphores, nullptr, &frame_index, 0), VK_SUCCESS);
+    EXPECT_EQ(frame_index, 0);
+    EXPECT_EQ(waited_values.back(), 1);
+
+    // waiting for the previous frame waits for frame 1, waiting for frame 0 again is skipped
+    waited_values.clear();
+    EXPECT_EQ(vk_lib::frame_context_wait_for_previous(&frame_context, fake_wait_semaphores, nullptr, 1, 0), VK_TIMEOUT);
+    EXPECT_EQ(waited_values.back(), 2);
+    EXPECT_EQ(vk_lib::frame_context_wait_for_previous(&frame_context, fake_wait_semaphores, nullptr, 2, 0), VK_SUCCESS);
+    EXPECT_EQ(waited_values.size(), 1);
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+#include <array>
+#include <gtest/gtest.h>
+#include <vk_lib/transfers.h>
+
+class StagingRingTestsFixture : public testing::Test {
+  public:
+    StagingRingTestsFixture() { ring = vk_lib::staging_ring(fake_buffer(1), ring_memory.data(), ring_memory.size()); }
+
+    ~StagingRingTestsFixture() override {}
+
+  protected:
+    static VkBuffer fake_buffer(uintptr_t id) { return reinterpret_cast<VkBuffer>(id); }
+
+    std::array<uint8_t, 1024> ring_memory{};
+    vk_lib::StagingRing       ring{};
+};
+
+TEST_F(StagingRingTestsFixture, batchesContiguousBufferCopies) {
+    std::array<uint8_t, 64> data{};
+    data.fill(7);
+    ASSERT_EQ(vk_lib::staging_ring_upload_buffer(&ring, fake_buffer(2), data.data(), data.size(), 0), VK_SUCCESS);
+    ASSERT_EQ(vk_lib::staging_ring_upload_buffer(&ring, fake_buffer(2), data.data(), data.size(), 64), VK_SUCCESS);
+    ASSERT_EQ(vk_lib::staging_ring_upload_buffer(&ring, fake_buffer(3), data.data(), data.size(), 0), VK_SUCCESS);
+
+    ASSERT_EQ(ring.buffer_copies.size(), 2);
+    ASSERT_EQ(ring.buffer_copies[0].regions.size(), 1);
+    EXPECT_EQ(ring.buffer_copies[0].regions[0].size, 128);
+    EXPECT_EQ(ring.buffer_copies[1].regions[0].srcOffset, 128);
+    EXPECT_EQ(ring_memory[127], 7);
+}
+
+TEST_F(StagingRingTestsFixture, reclaimsSpaceOnRetire) {
+    vk_lib::StagingAllocation allocation{};
+    ASSERT_EQ(vk_lib::staging_ring_allocate(&ring, 600, 16, &allocation), VK_SUCCESS);
+    vk_lib::staging_ring_end_frame(&ring, 1);
+
+    // does not fit behind the first frame and may not straddle the end of the buffer
+    ASSERT_EQ(vk_lib::staging_ring_allocate(&ring, 600, 16, &allocation), VK_NOT_READY);
+
+    vk_lib::staging_ring_retire(&ring, 1);
+    ASSERT_EQ(vk_lib::staging_ring_allocate(&ring, 600, 16, &allocation), VK_SUCCESS);
+    EXPECT_EQ(allocation.offset, 0);
+    EXPECT_EQ(allocation.data, ring_memory.data());
+}
+
+TEST_F(StagingRingTestsFixture, restartsEmptyRingAtStart) {
+    vk_lib::StagingAllocation allocation{};
+    ASSERT_EQ(vk_lib::staging_ring_allocate(&ring, 700, 1, &allocation), VK_SUCCESS);
+    vk_lib::staging_ring_end_frame(&ring, 1);
+    vk_lib::staging_ring_retire(&ring, 1);
+
+    // fits neither before nor after the head at 700, but nothing is in use anymore
+    ASSERT_EQ(vk_lib::staging_ring_allocate(&ring, 800, 1, &allocation), VK_SUCCESS);
+    EXPECT_EQ(allocation.offset, 0);
+    ASSERT_EQ(vk_lib::staging_ring_allocate(&ring, 300, 1, &allocation), VK_NOT_READY);
+}
+
+TEST_F(StagingRingTestsFixture, uploadQueueTransfersOwnership) {
+    std::array<uint8_t, 64> data{};
+    ASSERT_EQ(vk_lib::staging_ring_upload_buffer(&ring, fake_buffer(2), data.data(), data.size()), VK_SUCCESS);
+    VkImageSubresourceLayers subresource{};
+    subresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    subresource.layerCount = 1;
+    ASSERT_EQ(vk_lib::staging_ring_upload_image(&ring, reinterpret_cast<VkImage>(3), data.data(), data.size(), subresource, {4, 4, 1}), VK_SUCCESS);
+
+    vk_lib::UploadQueue upload_queue = vk_lib::upload_queue(ring, reinterpret_cast<VkSemaphore>(4), 1, 0);
+    vk_lib::upload_queue_build_barriers(&upload_queue, VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT, VK_ACCESS_2_SHADER_READ_BIT);
+
+    VkDependencyInfoKHR release = vk_lib::upload_queue_release_dependency_info(&upload_queue);
+    ASSERT_EQ(release.bufferMemoryBarrierCount, 1);
+    ASSERT_EQ(release.imageMemoryBarrierCount, 1);
+    EXPECT_EQ(release.pBufferMemoryBarriers[0].srcQueueFamilyIndex, 1);
+    EXPECT_EQ(release.pBufferMemoryBarriers[0].dstQueueFamilyIndex, 0);
+    EXPECT_EQ(release.pImageMemoryBarriers[0].newLayout, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+    VkDependencyInfoKHR acquire = vk_lib::upload_queue_acquire_dependency_info(&upload_queue);
+    ASSERT_EQ(acquire.imageMemoryBarrierCount, 1);
+    EXPECT_EQ(acquire.pImageMemoryBarriers[0].oldLayout, release.pImageMemoryBarriers[0].oldLayout);
+    EXPECT_EQ(acquire.pImageMemoryBarriers[0].dstAccessMask, VK_ACCESS_2_SHADER_READ_BIT);
+
+    VkSubmitInfo2KHR submit_info = vk_lib::upload_queue_submit_info(&upload_queue, reinterpret_cast<VkCommandBuffer>(5));
+    EXPECT_EQ(submit_info.pSignalSemaphoreInfos[0].value, 1);
+    EXPECT_EQ(vk_lib::upload_queue_wait_semaphore_submit_info(&upload_queue, VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT).value, 1);
+    EXPECT_TRUE(upload_queue.staging_ring.buffer_copies.empty());
+    ASSERT_EQ(upload_queue.staging_ring.in_flight.size(), 1);
+    EXPECT_EQ(upload_queue.staging_ring.in_flight[0].retire_value, 1);
+}
+
+TEST_F(StagingRingTestsFixture, uploadQueueTransitionsSubresourcesOnce) {
+    std::array<uint8_t, 64> data{};
+    VkImageSubresourceLayers subresource{};
+    subresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    subresource.layerCount = 1;
+    // two halves of mip 0 and all of mip 1
+    const VkImage image = reinterpret_cast<VkImage>(3);
+    ASSERT_EQ(vk_lib::staging_ring_upload_image(&ring, image, data.data(), data.size(), subresource, {4, 4, 1}, {0, 0, 0}), VK_SUCCESS);
+    ASSERT_EQ(vk_lib::staging_ring_upload_image(&ring, image, data.data(), data.size(), subresource, {4, 4, 1}, {0, 4, 0}), VK_SUCCESS);
+    subresource.mipLevel = 1;
+    ASSERT_EQ(vk_lib::staging_ring_upload_image(&ring, image, data.data(), data.size(), subresource, {4, 4, 1}), VK_SUCCESS);
+
+    vk_lib::UploadQueue upload_queue = vk_lib::upload_queue(ring, reinterpret_cast<VkSemaphore>(4), 1, 0);
+    vk_lib::upload_queue_build_barriers(&upload_queue, VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT, VK_ACCESS_2_SHADER_READ_BIT);
+
+    VkDependencyInfoKHR pre_copy = vk_lib::upload_queue_pre_copy_dependency_info(&upload_queue);
+    ASSERT_EQ(pre_copy.imageMemoryBarrierCount, 2);
+    EXPECT_EQ(pre_copy.pImageMemoryBarriers[0].subresourceRange.baseMipLevel, 0);
+    EXPECT_EQ(pre_copy.pImageMemoryBarriers[1].subresourceRange.baseMipLevel, 1);
+    EXPECT_EQ(vk_lib::upload_queue_release_dependency_info(&upload_queue).imageMemoryBarrierCount, 2);
+    EXPECT_EQ(vk_lib::upload_queue_acquire_dependency_info(&upload_queue).imageMemoryBarrierCount, 2);
+}
\ No newline at end of file